@@ -18,6 +18,43 @@ namespace c_adv {
 
             return true;
         }
+
+        float distance2d(const ysVector &p) const {
+            const float x = ysMath::GetX(p);
+            const float y = ysMath::GetY(p);
+
+            const float dx = max(max(ysMath::GetX(minPoint) - x, x - ysMath::GetX(maxPoint)), 0.0f);
+            const float dy = max(max(ysMath::GetY(minPoint) - y, y - ysMath::GetY(maxPoint)), 0.0f);
+
+            return std::sqrt(dx * dx + dy * dy);
+        }
+
+        // Slab test in 2D, t is the distance along the normalized direction
+        bool raycast2d(const ysVector &origin, const ysVector &direction, float maxDistance, float *t) const {
+            const float o[] = { ysMath::GetX(origin), ysMath::GetY(origin) };
+            const float d[] = { ysMath::GetX(direction), ysMath::GetY(direction) };
+            const float b0[] = { ysMath::GetX(minPoint), ysMath::GetY(minPoint) };
+            const float b1[] = { ysMath::GetX(maxPoint), ysMath::GetY(maxPoint) };
+
+            float t0 = 0.0f, t1 = maxDistance;
+            for (int i = 0; i < 2; ++i) {
+                if (std::abs(d[i]) < 1E-6f) {
+                    if (o[i] < b0[i] || o[i] > b1[i]) return false;
+                    continue;
+                }
+
+                float tNear = (b0[i] - o[i]) / d[i];
+                float tFar = (b1[i] - o[i]) / d[i];
+                if (tNear > tFar) std::swap(tNear, tFar);
+
+                t0 = max(t0, tNear);
+                t1 = min(t1, tFar);
+                if (t0 > t1) return false;
+            }
+
+            *t = t0;
+            return true;
+        }
     };
 
 } /* namespace c_adv */
@@ -0,0 +1,120 @@
+#ifndef CEREAL_ADVENTURE_AUDIO_SYSTEM_H
+#define CEREAL_ADVENTURE_AUDIO_SYSTEM_H
+
+#include "delta.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace c_adv {
+
+    enum class AudioGroup {
+        Footsteps,
+        Player,
+        Damage,
+        Emitter,
+        Pickup,
+        Count
+    };
+
+    // Sound requests are collected during the frame and resolved together:
+    // duplicates are merged, distant sounds are culled and each group is
+    // held to its voice cap, with higher priorities taking voices from lower
+    // ones. When threaded, resolution runs on the audio thread and the
+    // surviving sounds are played on the next update(), so the engine is
+    // only ever called from the main thread.
+    class AudioSystem {
+    public:
+        struct GroupSettings {
+            int maxVoices;
+
+            // The engine doesn't report when a sound ends, so a voice is
+            // assumed to be busy for this long
+            float voiceLength;
+        };
+
+        static const GroupSettings Groups[(int)AudioGroup::Count];
+
+        static constexpr float FullGainDistance = 15.0f;
+        static constexpr float CullDistance = 40.0f;
+
+    public:
+        AudioSystem();
+        ~AudioSystem();
+
+        void initialize(dbasic::DeltaEngine *engine, bool threaded);
+        void destroy();
+
+        // Positional sounds fade with distance from the listener, others are
+        // always heard at full gain
+        void play(dbasic::AudioAsset *asset, AudioGroup group, int priority);
+        void play(dbasic::AudioAsset *asset, AudioGroup group, int priority, const ysVector &position);
+
+        void update(float dt, float listenerX, float listenerY);
+
+        int getActiveVoices(AudioGroup group) const { return m_activeVoices[(int)group]; }
+        int getCulledCount() const { return m_culledCount; }
+
+    protected:
+        struct Request {
+            dbasic::AudioAsset *asset;
+            AudioGroup group;
+            int priority;
+            float gain;
+
+            bool positional;
+            float x, y;
+        };
+
+        struct Voice {
+            AudioGroup group;
+            int priority;
+            float endTime;
+        };
+
+        struct Resolved {
+            std::vector<dbasic::AudioAsset *> commands;
+            int culledCount = 0;
+            int activeVoices[(int)AudioGroup::Count] = {};
+        };
+
+        void resolve(std::vector<Request> &requests, float dt, float listenerX, float listenerY, Resolved &resolved);
+        void coalesce(std::vector<Request> &requests);
+        bool allocateVoice(const Request &request);
+        void playResolved(Resolved &resolved);
+        void worker();
+
+    protected:
+        dbasic::DeltaEngine *m_engine;
+
+        std::vector<Request> m_requests;
+        int m_culledCount;
+        int m_activeVoices[(int)AudioGroup::Count];
+
+        // Only touched by whichever thread resolves requests
+        std::vector<Voice> m_voices;
+        float m_time;
+
+        // Requests handed to the audio thread and the sounds it resolved,
+        // both guarded by the lock
+        std::vector<Request> m_pending;
+        float m_pendingDt;
+        float m_listenerX, m_listenerY;
+        Resolved m_results;
+
+        std::vector<Request> m_resolving;
+        Resolved m_resolved;
+        Resolved m_playing;
+
+        std::thread m_thread;
+        std::mutex m_lock;
+        std::condition_variable m_requestsAvailable;
+        bool m_running;
+        bool m_threaded;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_AUDIO_SYSTEM_H */
@@ -0,0 +1,44 @@
+#ifndef CEREAL_ADVENTURE_BOUNDS_BUFFER_H
+#define CEREAL_ADVENTURE_BOUNDS_BUFFER_H
+
+#include "aabb.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    // 2D bounds stored as separate contiguous arrays so that they can be
+    // scanned several entries at a time
+    class BoundsBuffer {
+    public:
+        BoundsBuffer();
+        ~BoundsBuffer();
+
+        void push(const AABB &bounds);
+        void set(int index, const AABB &bounds);
+        void removeSwap(int index);
+        void clear();
+
+        // Reorders entries so that entry i becomes the old entry order[i]
+        void permute(const std::vector<int> &order);
+
+        AABB get(int index) const;
+        int size() const { return (int)m_minX.size(); }
+
+        const float *minX() const { return m_minX.data(); }
+        const float *minY() const { return m_minY.data(); }
+        const float *maxX() const { return m_maxX.data(); }
+        const float *maxY() const { return m_maxY.data(); }
+
+    protected:
+        std::vector<float> m_minX;
+        std::vector<float> m_minY;
+        std::vector<float> m_maxX;
+        std::vector<float> m_maxY;
+
+        std::vector<float> m_scratch;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_BOUNDS_BUFFER_H */
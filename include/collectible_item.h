@@ -3,13 +3,16 @@
 
 #include "game_object.h"
 
+#include "task.h"
 #include "wave_generator.h"
 #include "wrapping_timer.h"
-#include "cooldown_timer.h"
 
 namespace c_adv {
 
     class CollectibleItem : public GameObject {
+    public:
+        static constexpr float CollectionTime = 0.3f;
+
     public:
         CollectibleItem();
         ~CollectibleItem();
@@ -19,6 +22,9 @@ namespace c_adv {
         virtual void render();
         virtual void process(float dt);
 
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
         void setAsset(dbasic::ModelAsset *asset) { m_asset = asset; }
         dbasic::ModelAsset *getAsset() const { return m_asset; }
 
@@ -27,6 +33,8 @@ namespace c_adv {
 
     protected:
         void collidingWithPlayerCheck();
+        void collectionSequence(Task &task);
+        float getCollectionProgress();
 
     protected:
         ysVector m_glowColor;
@@ -37,7 +45,7 @@ namespace c_adv {
         WaveGenerator m_rAxis_z;
         WrappingTimer m_spinTimer;
 
-        CooldownTimer m_collectionTimer;
+        Task m_collection;
 
         dbasic::ModelAsset *m_asset;
         dbasic::AudioAsset *m_audio;
@@ -0,0 +1,36 @@
+#ifndef CEREAL_ADVENTURE_COLLISION_MATRIX_H
+#define CEREAL_ADVENTURE_COLLISION_MATRIX_H
+
+#include "game_object.h"
+
+#include <stdint.h>
+
+namespace c_adv {
+
+    // Symmetric table of which collision layers may form contact pairs. It is
+    // written into every collision object when its body is registered so the
+    // broadphase rejects filtered pairs before narrowphase.
+    class CollisionMatrix {
+    public:
+        static constexpr int MaxLayers = 32;
+        static_assert((int)GameObject::Layer::Count <= MaxLayers, "Too many collision layers");
+
+    public:
+        CollisionMatrix();
+        ~CollisionMatrix();
+
+        void reset();
+        void setCollides(GameObject::Layer a, GameObject::Layer b, bool collides);
+        bool collides(GameObject::Layer a, GameObject::Layer b) const;
+
+        uint32_t getMask(GameObject::Layer layer) const { return m_masks[(int)layer]; }
+
+        void apply(GameObject *object) const;
+
+    protected:
+        uint32_t m_masks[MaxLayers];
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_COLLISION_MATRIX_H */
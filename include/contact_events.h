@@ -0,0 +1,39 @@
+#ifndef CEREAL_ADVENTURE_CONTACT_EVENTS_H
+#define CEREAL_ADVENTURE_CONTACT_EVENTS_H
+
+#include "delta.h"
+
+namespace c_adv {
+
+    class GameObject;
+
+    struct ContactEvent {
+        enum class Type {
+            Begin,
+            Persist
+        };
+
+        Type type;
+        GameObject *object;
+        GameObject *other;
+
+        ysVector position;
+
+        // Normal and closing velocity are given from the point of view of
+        // the subscribed object
+        ysVector normal;
+        ysVector closingVelocity;
+    };
+
+    struct DamageEvent {
+        // Null if the damage didn't come from an object
+        GameObject *source;
+        GameObject *target;
+
+        float amount;
+        ysVector impulse;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_CONTACT_EVENTS_H */
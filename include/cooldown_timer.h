@@ -1,6 +1,8 @@
 #ifndef CEREAL_ADVENTURE_COOLDOWN_TIMER_H
 #define CEREAL_ADVENTURE_COOLDOWN_TIMER_H
 
+#include "state_archive.h"
+
 namespace c_adv {
 
     class CooldownTimer {
@@ -19,9 +21,13 @@ namespace c_adv {
 
         float get() const { return m_timer / m_cooldownPeriod; }
 
+        void reset() { m_triggered = false; m_timer = 0.0f; }
         void enable() { m_enabled = true; }
         void disable() { m_enabled = false; }
 
+        void saveState(StateArchive &archive) const;
+        void loadState(StateArchive &archive);
+
     protected:
         float m_timer;
         float m_cooldownPeriod;
@@ -0,0 +1,33 @@
+#ifndef CEREAL_ADVENTURE_CULLING_H
+#define CEREAL_ADVENTURE_CULLING_H
+
+#include "aabb.h"
+#include "bounds_buffer.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    enum class CullingPath {
+        Scalar,
+        Sse,
+        Avx2
+    };
+
+    // Appends the index of every box that overlaps the extents in 2D.
+    // Indices are appended in increasing order.
+    void cullBounds(
+        const BoundsBuffer &bounds, const AABB &extents, std::vector<int> &visible, int indexOffset = 0);
+    void cullBounds(
+        const float *minX, const float *minY, const float *maxX, const float *maxY, int count,
+        const AABB &extents, std::vector<int> &visible, int indexOffset = 0);
+    void cullBoundsScalar(
+        const float *minX, const float *minY, const float *maxX, const float *maxY, int count,
+        const AABB &extents, std::vector<int> &visible, int indexOffset = 0);
+
+    CullingPath getCullingPath();
+    const char *getCullingPathName(CullingPath path);
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_CULLING_H */
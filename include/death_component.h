@@ -1,7 +1,7 @@
 #ifndef CEREAL_ADVENTURE_DEATH_COMPONENT_H
 #define CEREAL_ADVENTURE_DEATH_COMPONENT_H
 
-#include "cooldown_timer.h"
+#include "task.h"
 
 #include "delta.h"
 
@@ -11,8 +11,6 @@ namespace c_adv {
     class GameObject;
 
     class DeathComponent {
-        friend Player;
-
     public:
         static const float AfterDeathSequenceLength;
 
@@ -23,8 +21,18 @@ namespace c_adv {
         void initialize(Player *player);
         void process(float dt);
 
+        // Called once when the player's health runs out
+        void onDeath();
+        void reset();
+
+        void saveState(StateArchive &archive) const;
+        void loadState(StateArchive &archive);
+
+    protected:
+        void afterDeathSequence(Task &task);
+
     protected:
-        CooldownTimer m_afterDeathCooldown;
+        Task m_afterDeathSequence;
         Player *m_player;
     };
 
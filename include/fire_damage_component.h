@@ -1,6 +1,7 @@
 #ifndef CEREAL_ADVENTURE_FIRE_DAMAGE_COMPONENT_H
 #define CEREAL_ADVENTURE_FIRE_DAMAGE_COMPONENT_H
 
+#include "contact_events.h"
 #include "cooldown_timer.h"
 
 #include "delta.h"
@@ -21,7 +22,7 @@ namespace c_adv {
         void process(float dt);
 
     protected:
-        GameObject *getCollidingOven(ysVector &position);
+        void onContact(const ContactEvent &contact);
 
         CooldownTimer m_fireDamageCooldown;
         Player *m_player;
@@ -0,0 +1,87 @@
+#ifndef CEREAL_ADVENTURE_FORCE_FIELD_SYSTEM_H
+#define CEREAL_ADVENTURE_FORCE_FIELD_SYSTEM_H
+
+#include "delta.h"
+
+#include <float.h>
+#include <unordered_map>
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+    class Realm;
+
+    struct ForceField {
+        enum class Shape {
+            Box,
+            Circle,
+            Cone
+        };
+
+        Shape shape = Shape::Circle;
+
+        // Box center, circle center or cone apex
+        float x = 0.0f;
+        float y = 0.0f;
+
+        // Cone axis and the axis that the velocity cap is measured along
+        float directionX = 1.0f;
+        float directionY = 0.0f;
+
+        // Box x axis, the y axis is perpendicular to it
+        float axisX = 1.0f;
+        float axisY = 0.0f;
+
+        float halfWidth = 0.0f;
+        float halfHeight = 0.0f;
+        float radius = 0.0f;
+        float cosHalfAngle = 0.0f;
+
+        float forceX = 0.0f;
+        float forceY = 0.0f;
+
+        // Force is scaled by 1 - falloff * (distance / range)
+        float falloff = 0.0f;
+
+        // Bodies moving faster than this along the direction are unaffected
+        float maxVelocity = FLT_MAX;
+    };
+
+    // Evaluates all force fields of a realm against its dynamic bodies. Each
+    // field only gathers the bodies that overlap its bounds into flat arrays,
+    // which are then tested with a loop specific to the field's shape.
+    class ForceFieldSystem {
+    public:
+        ForceFieldSystem();
+        ~ForceFieldSystem();
+
+        // Fields are keyed by the object that owns them
+        void setField(GameObject *owner, const ForceField &field);
+        void removeField(GameObject *owner);
+        void clear();
+
+        void apply(Realm *realm);
+
+        int getFieldCount() const { return (int)m_fields.size(); }
+
+    protected:
+        void gather(Realm *realm, const ForceField &field);
+        void evaluateBox(const ForceField &field);
+        void evaluateCircle(const ForceField &field);
+        void evaluateCone(const ForceField &field);
+
+    protected:
+        std::vector<ForceField> m_fields;
+        std::vector<GameObject *> m_owners;
+        std::unordered_map<GameObject *, int> m_fieldIndex;
+
+        std::vector<GameObject *> m_bodies;
+        std::vector<float> m_px, m_py;
+        std::vector<float> m_vx, m_vy;
+        std::vector<float> m_fx, m_fy;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_FORCE_FIELD_SYSTEM_H */
@@ -3,11 +3,13 @@
 
 #include "game_object.h"
 
-#include "clock.h"
-
 namespace c_adv {
 
     class FruitBowl : public GameObject {
+    public:
+        static constexpr float FirePeriod = 10.0f;
+        static constexpr float FruitRadius = 0.57f / 2;
+
     public:
         FruitBowl();
         ~FruitBowl();
@@ -15,13 +17,17 @@ namespace c_adv {
         virtual void initialize();
 
         virtual void render();
-        virtual void process(float dt);
+
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
 
         void setOrientation(const ysQuaternion &quaternion) { m_renderTransform.SetOrientation(quaternion); }
 
+    protected:
+        void fire();
+
     protected:
         ysTransform m_renderTransform;
-        Clock m_clock;
 
         // Assets ----
     public:
@@ -17,6 +17,9 @@ namespace c_adv {
         virtual void render();
         virtual void process(float dt);
 
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
         void setRadius(float radius) { m_radius = radius; }
         float getRadius() const { return m_radius; }
 
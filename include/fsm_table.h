@@ -0,0 +1,80 @@
+#ifndef CEREAL_ADVENTURE_FSM_TABLE_H
+#define CEREAL_ADVENTURE_FSM_TABLE_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace c_adv {
+
+    // Input bits sampled once per agent per tick
+    namespace FsmInput {
+        enum : uint32_t {
+            OnSurface       = 1u << 0,
+            Hurt            = 1u << 1,
+            Hanging         = 1u << 2,
+            GraspReady      = 1u << 3,
+            Launching       = 1u << 4,
+            ActionComplete  = 1u << 5,
+            Alive           = 1u << 6,
+            Moving          = 1u << 7, // |vx| > 1
+            Slow            = 1u << 8, // |vx| < 1
+            FastFalling     = 1u << 9  // falling faster than 9
+        };
+    }
+
+    // A transition fires when every bit in require is set and every bit in
+    // reject is clear. Rows are tested in order and the first match wins.
+    struct FsmTransition {
+        static constexpr int Keep = -1;
+        static constexpr int None = -1;
+
+        int from;
+        uint32_t require;
+        uint32_t reject;
+
+        int next;           // Keep leaves the state unchanged
+        float nextFade;
+        float nextClip;
+
+        int queued;         // None queues nothing
+        float queuedFade;
+        float queuedClip;
+
+        float speed;
+    };
+
+    struct FsmOutputs {
+        std::vector<int> next;
+        std::vector<int> queued;
+        std::vector<float> nextFade;
+        std::vector<float> nextClip;
+        std::vector<float> queuedFade;
+        std::vector<float> queuedClip;
+        std::vector<float> speed;
+
+        void resize(int count);
+    };
+
+    class FsmTable {
+    public:
+        constexpr FsmTable(const FsmTransition *transitions, int count, int undefinedState)
+            : m_transitions(transitions), m_count(count), m_undefinedState(undefinedState) {}
+
+        // Steps count agents at once, agents without a matching row keep
+        // their state and queue nothing
+        void evaluate(const int *states, const uint32_t *inputs, int count, FsmOutputs &outputs) const;
+
+        // Returns the matching row with Keep and None replaced by real states
+        FsmTransition evaluate(int state, uint32_t inputs) const;
+
+        int getUndefinedState() const { return m_undefinedState; }
+
+    protected:
+        const FsmTransition *m_transitions;
+        int m_count;
+        int m_undefinedState;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_FSM_TABLE_H */
@@ -2,9 +2,14 @@
 #define CEREAL_ADVENTURE_GAME_OBJECT_H
 
 #include "aabb.h"
+#include "contact_events.h"
+#include "state_archive.h"
 
 #include "delta.h"
 
+#include <functional>
+#include <vector>
+
 #define GET_ASSET(static_var, method) (static_var) = ((static_var) == nullptr) ? (method) : (static_var);
 
 namespace c_adv {
@@ -13,18 +18,14 @@ namespace c_adv {
     class Realm;
 
     class GameObject {
+    public:
+        typedef std::function<void(const ContactEvent &)> ContactListener;
+
     public:
         static constexpr int PlayerFrictionMaterial = 0;
         static constexpr int GenericFrictionMaterial = 1;
 
-        static constexpr int EmitterCollisionLayer = 1;
-        static constexpr int ProjectileCollisionLayer = 2;
-
-        enum class CollisionLayers {
-            Main = 0x0,
-            Box = 0x1,
-        };
-
+        // Shared by render layers and collision layers, see CollisionMatrix
         enum class Layer {
             Ground,
             Holes,
@@ -32,7 +33,11 @@ namespace c_adv {
             Mob,
             PlayerCarriedItem,
             Player,
-            Wall
+            Wall,
+            Emitter,
+            Projectile,
+            Static,
+            Count
         };
 
         enum class Tag {
@@ -41,12 +46,13 @@ namespace c_adv {
             Oven,
             Player,
             Projectile,
+            Static,
             Count
         };
 
     public:
         GameObject();
-        ~GameObject();
+        virtual ~GameObject();
 
         dphysics::RigidBody RigidBody;
 
@@ -62,6 +68,53 @@ namespace c_adv {
         virtual void process(float dt);
         virtual void getAssets(dbasic::AssetManager *am);
 
+        // Serialized state must be enough to recreate the object by applying
+        // it to a freshly constructed instance before initialize() is called
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
+        // Runtime state such as timers and health is only ever loaded into an
+        // object that is alive and initialized
+        virtual void saveRuntimeState(StateArchive &archive) { /* void */ }
+        virtual void loadRuntimeState(StateArchive &archive) { /* void */ }
+
+        // Brings a dead object back so it can be registered again
+        virtual void revive();
+
+        unsigned int getObjectId() const { return m_objectId; }
+        void setObjectId(unsigned int id) { m_objectId = id; }
+
+        // Objects with tick LOD enabled are processed less often the further
+        // they are from the camera, receiving the accumulated time step
+        void setTickLodEnabled(bool enabled) { m_tickLodEnabled = enabled; }
+        bool isTickLodEnabled() const { return m_tickLodEnabled; }
+
+        void setTickInterval(int interval) { m_tickInterval = interval; }
+        int getTickInterval() const { return m_tickInterval; }
+
+        void setTickPhase(int phase) { m_tickPhase = phase; }
+        bool accumulateTick(float dt, unsigned int frame, float *tickDt);
+
+        // Objects with a wake region sleep, skipping process() and losing their
+        // force field, until a dynamic body or the player overlaps the region.
+        // The region is relative to the object's position.
+        void setWakeRegion(const AABB &region) { m_wakeRegion = region; m_sleepEnabled = true; }
+        void setWakeRadius(float radius);
+        AABB getWakeRegionWorld();
+        bool isSleepEnabled() const { return m_sleepEnabled; }
+
+        bool isSleeping() const { return m_sleeping; }
+        void setSleeping(bool sleeping) { m_sleeping = sleeping; }
+
+        virtual bool canSleep() { return true; }
+
+        // Applied to every collision object when the body is registered
+        void setCollisionLayer(Layer layer) { m_collisionLayer = layer; }
+        Layer getCollisionLayer() const { return m_collisionLayer; }
+
+        int getTypeId() const { return m_typeId; }
+        void setTypeId(int typeId) { m_typeId = typeId; }
+
         virtual void onCarry();
         virtual void onDrop();
 
@@ -90,7 +143,7 @@ namespace c_adv {
         void setRealm(Realm *realm) { m_realm = realm; }
         Realm *getRealm() const { return m_realm; }
 
-        virtual void changeRealm(Realm *newRealm) { m_newRealm = newRealm; m_changeRealm = true; }
+        virtual void changeRealm(Realm *newRealm);
         Realm *getNewRealm() const { return m_newRealm; }
 
         void resetRealmChange() { m_changeRealm = false; m_newRealm = nullptr; }
@@ -103,6 +156,14 @@ namespace c_adv {
         void addVisualBound(const AABB &bound);
         virtual void createVisualBounds();
 
+        // Objects without collision geometry can still be found by spatial
+        // queries if they are given a bounds radius around their position
+        void setBoundsRadius(float radius) { m_boundsRadius = radius; }
+        float getBoundsRadius() const { return m_boundsRadius; }
+
+        // Returns true if the rigid body moved since the last call
+        bool updateTransformCache();
+
         void incrementReferenceCount() { ++m_referenceCount; }
         void decrementReferenceCount() { --m_referenceCount; }
         int getReferenceCount() const { return m_referenceCount; }
@@ -119,11 +180,25 @@ namespace c_adv {
         virtual Realm *getTargetRealm() { return nullptr; }
         virtual Realm *generateRealm() { return nullptr; }
 
+        Realm *resolveTargetRealm();
+        void sendThroughPortal(GameObject *object);
+
         // Get whether this object has been fully registered in its realm
         bool isReal() const { return m_real; }
 
         virtual bool isDangerous() { return false; }
 
+        // Listeners survive realm transfers. Contacts found by a physics step
+        // are delivered at the start of the next process().
+        void addContactListener(const ContactListener &listener) { m_contactListeners.push_back(listener); }
+        bool hasContactListeners() const { return !m_contactListeners.empty(); }
+        void dispatchContact(const ContactEvent &event);
+
+        // Objects that were in contact after the last physics step
+        std::vector<GameObject *> &getContactSet() { return m_contactSet; }
+
+        virtual void onDamage(const DamageEvent &event) { /* void */ }
+
     protected:
         AABB m_visualBounds;
 
@@ -138,6 +213,13 @@ namespace c_adv {
         Realm *m_newRealm;
         bool m_changeRealm;
         GameObject *m_lastPortal;
+        Realm *m_targetRealm;
+
+        // Scratch buffer for spatial queries
+        std::vector<GameObject *> m_nearbyObjects;
+
+        std::vector<ContactListener> m_contactListeners;
+        std::vector<GameObject *> m_contactSet;
 
     private:
         bool m_beingCarried;
@@ -152,7 +234,27 @@ namespace c_adv {
         std::vector<bool> m_tags;
 
     private:
+        static unsigned int s_nextObjectId;
+
+        unsigned int m_objectId;
         int m_realmRecordIndex;
+        int m_typeId;
+        Layer m_collisionLayer;
+
+        float m_boundsRadius;
+
+        ysVector m_cachedPosition;
+        ysVector m_cachedOrientation;
+        bool m_transformCacheValid;
+
+        bool m_tickLodEnabled;
+        int m_tickInterval;
+        int m_tickPhase;
+        float m_tickAccumulator;
+
+        AABB m_wakeRegion;
+        bool m_sleepEnabled;
+        bool m_sleeping;
     };
 
 } /* namespace c_adv */
@@ -26,6 +26,7 @@
 #include "../include/fan.h"
 #include "../include/table.h"
 #include "../include/collectible_item.h"
+#include "../include/mob_spawner.h"
 #include "../include/light_object.h"
 #include "../include/turn_table_camera.h"
 #include "../include/debug_camera_controller.h"
@@ -0,0 +1,50 @@
+#ifndef CEREAL_ADVENTURE_JOB_SYSTEM_H
+#define CEREAL_ADVENTURE_JOB_SYSTEM_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace c_adv {
+
+    class JobSystem {
+    public:
+        typedef std::function<void()> Job;
+
+    public:
+        JobSystem();
+        ~JobSystem();
+
+        void initialize(int threadCount);
+        void destroy();
+
+        void kick(const Job &job);
+
+        // Blocks until every kicked job has finished, running jobs on the
+        // calling thread while it waits
+        void wait();
+
+        int getThreadCount() const { return (int)m_threads.size(); }
+
+    protected:
+        void worker();
+        bool runNext();
+
+    protected:
+        std::vector<std::thread> m_threads;
+        std::queue<Job> m_jobs;
+
+        std::mutex m_lock;
+        std::condition_variable m_jobAvailable;
+        std::condition_variable m_jobsComplete;
+
+        int m_pending;
+        bool m_running;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_JOB_SYSTEM_H */
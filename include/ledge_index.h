@@ -0,0 +1,42 @@
+#ifndef CEREAL_ADVENTURE_LEDGE_INDEX_H
+#define CEREAL_ADVENTURE_LEDGE_INDEX_H
+
+#include "delta.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+
+    // Ledge positions sorted by x so that the ledges around a point can be
+    // found with a binary search followed by a short scan
+    class LedgeIndex {
+    public:
+        LedgeIndex();
+        ~LedgeIndex();
+
+        void clear();
+        void add(GameObject *ledge);
+        void build();
+
+        // Appends every ledge within the given radius of the point
+        void query(const ysVector &point, float radius, std::vector<GameObject *> &ledges) const;
+
+        int getLedgeCount() const { return (int)m_entries.size(); }
+
+    protected:
+        struct Entry {
+            float x;
+            float y;
+            GameObject *ledge;
+
+            bool operator<(const Entry &b) const { return x < b.x; }
+        };
+
+        std::vector<Entry> m_entries;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_LEDGE_INDEX_H */
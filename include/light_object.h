@@ -15,6 +15,9 @@ namespace c_adv {
         virtual void render();
         virtual void process(float dt);
 
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
         void setAsset(dbasic::SceneObjectAsset *asset) { m_asset = asset; }
         dbasic::SceneObjectAsset *getAsset() const { return m_asset; }
 
@@ -3,6 +3,8 @@
 
 #include "delta.h"
 
+#include <vector>
+
 namespace c_adv {
 
     ysVector vector3d(const ysVector &b);
@@ -17,6 +19,13 @@ namespace c_adv {
     uint64_t bitwiseInterleave(uint32_t x, uint32_t y);
     uint64_t bitwiseReverse(uint64_t input, int bits);
 
+    // Morton code of a 2D position quantized to cells of the given size
+    uint64_t mortonCode2d(float x, float y, float cellSize);
+
+    // Stable LSD radix sort producing the permutation that orders the keys.
+    // Byte passes where every key has the same digit are skipped.
+    void radixSortIndices(const uint64_t *keys, int count, std::vector<int> &order, std::vector<int> &scratch);
+
 } /* namespace c_adv */
 
 #endif /* CEREAL_ADVENTURE_MATH_UTILITIES_H */
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef CEREAL_ADVENTURE_MOB_H
+#define CEREAL_ADVENTURE_MOB_H
+
+#include "game_object.h"
+
+#include "cooldown_timer.h"
+#include "mob_system.h"
+
+namespace c_adv {
+
+    // A mob that came close enough to a player to need real physics. It is
+    // handed back to its realm's MobSystem once every player is far away.
+    class Mob : public GameObject {
+    public:
+        static constexpr float ContactDamage = 1.0f;
+
+    public:
+        Mob();
+        ~Mob();
+
+        virtual void initialize();
+
+        virtual void render();
+        virtual void process(float dt);
+
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
+        void setAgent(const MobAgent &agent);
+
+    protected:
+        void onContact(const ContactEvent &contact);
+        void demote();
+
+    protected:
+        MobAgent m_agent;
+        CooldownTimer m_attackCooldown;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_MOB_H */
@@ -0,0 +1,35 @@
+#ifndef CEREAL_ADVENTURE_MOB_SPAWNER_H
+#define CEREAL_ADVENTURE_MOB_SPAWNER_H
+
+#include "game_object.h"
+
+namespace c_adv {
+
+    // Places a group of mobs on the surface below it. The agents are handed
+    // to the realm's MobSystem and the spawner removes itself.
+    class MobSpawner : public GameObject {
+    public:
+        static constexpr int DefaultCount = 2;
+        static constexpr float Spacing = 1.0f;
+
+    public:
+        MobSpawner();
+        ~MobSpawner();
+
+        virtual void initialize();
+
+        virtual void process(float dt);
+
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
+        void setCount(int count) { m_count = count; }
+        int getCount() const { return m_count; }
+
+    protected:
+        int m_count;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_MOB_SPAWNER_H */
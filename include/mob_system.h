@@ -0,0 +1,116 @@
+#ifndef CEREAL_ADVENTURE_MOB_SYSTEM_H
+#define CEREAL_ADVENTURE_MOB_SYSTEM_H
+
+#include "aabb.h"
+#include "fsm_table.h"
+#include "state_archive.h"
+
+#include "delta.h"
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+    class Realm;
+
+    struct MobAgent {
+        float x = 0.0f;
+        float y = 0.0f;
+        float velocityX = 0.0f;
+
+        // Mobs patrol within range of home until a player comes close
+        float homeX = 0.0f;
+        float patrolRange = 4.0f;
+        float speed = 3.0f;
+        float direction = 1.0f;
+    };
+
+    // Enemies that walk along the surface they were placed on. Agents live
+    // in flat arrays and are steered in parallel on the job system; only
+    // those near a player are promoted to full Mob objects with a rigid body.
+    class MobSystem {
+    public:
+        static constexpr int JobSize = 1024;
+
+        static constexpr float CellSize = 2.0f;
+        static constexpr float SeparationRadius = 1.0f;
+        static constexpr int MaxNeighbors = 8;
+
+        static constexpr float ChaseRadius = 12.0f;
+        static constexpr float ChaseHeight = 2.0f;
+        static constexpr float ChaseSpeedScale = 1.5f;
+        static constexpr float Acceleration = 20.0f;
+
+        static constexpr float PromoteRadius = 8.0f;
+        static constexpr float DemoteRadius = 12.0f;
+
+        static constexpr float HalfWidth = 0.4f;
+        static constexpr float HalfHeight = 0.6f;
+
+        // Agents stand on the highest solid static within this distance below
+        // their feet and keep to its top along with any flush neighbors
+        static constexpr float SurfaceProbeDepth = 2.0f;
+        static constexpr float SurfaceTolerance = 0.05f;
+        static constexpr int MaxSurfaceSegments = 16;
+
+    public:
+        MobSystem();
+        ~MobSystem();
+
+        void emit(const MobAgent &agent, Realm *realm);
+
+        // Releases the memory of every array along with the agents
+        void clear();
+
+        void saveState(StateArchive &archive) const;
+        void loadState(StateArchive &archive);
+
+        void update(float dt, Realm *realm);
+        void render(Realm *realm, const AABB &extents);
+
+        int getCount() const { return (int)m_x.size(); }
+
+        // Leg animation outputs of the last update, one entry per agent
+        const std::vector<int> &getLegsStates() const { return m_legsState; }
+        const FsmOutputs &getLegsOutputs() const { return m_legsOutputs; }
+
+    protected:
+        void findTargets(Realm *realm);
+        void buildNeighborIndex();
+        void steer(int begin, int end, float dt);
+        void integrate(int begin, int end, float dt);
+        void promote(Realm *realm);
+        void removeSwap(int index);
+
+        bool findSurface(Realm *realm, float x, float y, float *top, float *minX, float *maxX);
+
+        uint64_t cellKey(float x, float y) const;
+        static uint64_t cellKey(int x, int y);
+
+    protected:
+        std::vector<float> m_x, m_y;
+        std::vector<float> m_vx;
+        std::vector<float> m_minX, m_maxX;
+        std::vector<float> m_homeX;
+        std::vector<float> m_patrolRange;
+        std::vector<float> m_speed;
+        std::vector<float> m_direction;
+        std::vector<int> m_legsState;
+        std::vector<uint32_t> m_inputs;
+
+        FsmOutputs m_legsOutputs;
+
+        // Agents sorted by cell for neighbor queries from worker threads
+        std::vector<std::pair<uint64_t, int>> m_cells;
+
+        std::vector<float> m_targetX, m_targetY;
+        std::vector<GameObject *> m_targets;
+        std::vector<GameObject *> m_obstacles;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_MOB_SYSTEM_H */
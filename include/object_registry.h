@@ -0,0 +1,41 @@
+#ifndef CEREAL_ADVENTURE_OBJECT_REGISTRY_H
+#define CEREAL_ADVENTURE_OBJECT_REGISTRY_H
+
+#include "delta.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+
+    // Maps spawned object types to small integer ids so that objects can be
+    // recreated from a serialized realm. Ids are assigned in the order that
+    // types are first spawned and are only valid for the running process.
+    class ObjectRegistry {
+    public:
+        typedef GameObject *(*Constructor)();
+
+    public:
+        template <typename T>
+        static int typeId() {
+            static const int id = registerType(&construct<T>);
+            return id;
+        }
+
+        static GameObject *create(int typeId);
+
+    protected:
+        template <typename T>
+        static GameObject *construct() {
+            void *buffer = _aligned_malloc(sizeof(T), 16);
+            return new (buffer) T;
+        }
+
+        static int registerType(Constructor constructor);
+        static std::vector<Constructor> &constructors();
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_OBJECT_REGISTRY_H */
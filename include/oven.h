@@ -3,14 +3,13 @@
 
 #include "game_object.h"
 
-#include "clock.h"
-
 namespace c_adv {
 
     class Oven : public GameObject {
     public:
         static constexpr float HalfHeight = 1.0f;
         static constexpr float HalfWidth = 1.0f;
+        static constexpr float HeatPeriod = 2.0f;
 
     public:
         Oven();
@@ -19,13 +18,15 @@ namespace c_adv {
         virtual void initialize();
 
         virtual void render();
-        virtual void process(float dt);
 
         bool isHot();
         bool isDangerous(const ysVector &p_world);
 
     protected:
-        Clock m_clock;
+        void toggleHeat();
+
+    protected:
+        bool m_hot;
 
         // Assets ----
     public:
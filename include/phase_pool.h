@@ -0,0 +1,46 @@
+#ifndef CEREAL_ADVENTURE_PHASE_POOL_H
+#define CEREAL_ADVENTURE_PHASE_POOL_H
+
+#include <vector>
+
+namespace c_adv {
+
+    // Contiguous pool of periodic phases in [0, 1) that are all advanced in
+    // a single pass. Pools that generate waves also evaluate sin(2 * pi * t)
+    // for every entry with a polynomial approximation.
+    class PhasePool {
+    public:
+        PhasePool(bool generateWaves);
+        ~PhasePool();
+
+        int allocate();
+        void release(int handle);
+
+        void update(float dt);
+
+        float getPhase(int handle) const { return m_phase[handle]; }
+        void setPhase(int handle, float phase) { m_phase[handle] = phase; }
+
+        float getValue(int handle) const { return m_value[handle]; }
+
+        void setPeriod(int handle, float period);
+        float getPeriod(int handle) const { return m_period[handle]; }
+
+        int getActiveCount() const { return (int)(m_phase.size() - m_freeList.size()); }
+
+        // Approximates sin(2 * pi * t) for t in [0, 1)
+        static float sinTurns(float t);
+
+    protected:
+        std::vector<float> m_phase;
+        std::vector<float> m_rate;
+        std::vector<float> m_period;
+        std::vector<float> m_value;
+        std::vector<int> m_freeList;
+
+        bool m_generateWaves;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_PHASE_POOL_H */
@@ -35,6 +35,8 @@ namespace c_adv {
             Undefined
         };
 
+        static constexpr float MaxHealth = 20.0f;
+
     public:
         Player();
         ~Player();
@@ -43,6 +45,10 @@ namespace c_adv {
         virtual void process(float dt);
         virtual void render();
 
+        virtual void revive();
+        virtual void saveRuntimeState(StateArchive &archive);
+        virtual void loadRuntimeState(StateArchive &archive);
+
         bool isAlive() const;
         bool isHurt() const;
         bool isHanging();
@@ -60,6 +66,7 @@ namespace c_adv {
         ysVector getGripLocationWorld();
 
         void takeDamage(float damage);
+        virtual void onDamage(const DamageEvent &damage);
 
         ysAnimationActionBinding *getArmsAction(PlayerArmsFsm::State state);
         ysAnimationActionBinding *getLegsAction(PlayerLegsFsm::State state);
@@ -67,9 +74,10 @@ namespace c_adv {
     protected:
         void updateMotion(float dt);
         void updateAnimation(float dt);
-        void legsAnimationFsm();
+        uint32_t getFsmInputs();
+        void legsAnimationFsm(uint32_t inputs);
         void rotationAnimationFsm();
-        void armsAnimationFsm();
+        void armsAnimationFsm(uint32_t inputs);
         void updateSoundEffects();
         void onJump();
         void onLand();
@@ -77,7 +85,8 @@ namespace c_adv {
         void playFootstepSound();
         void playShakeSound();
 
-        void processImpactDamage();
+        void processImpactDamage(const ContactEvent &contact);
+        void resetAnimation();
         void updateCollisionBounds();
 
     protected:
@@ -1,13 +1,11 @@
 #ifndef CEREAL_ADVENTURE_PLAYER_ARMS_FSM_H
 #define CEREAL_ADVENTURE_PLAYER_ARMS_FSM_H
 
-namespace c_adv {
+#include "fsm_table.h"
 
-    class Player;
+namespace c_adv {
 
     class PlayerArmsFsm {
-        friend Player;
-
     public:
         enum class State {
             Idle,
@@ -30,18 +28,20 @@ namespace c_adv {
             float speed;
         };
 
+        // Shared by every agent animated with the cereal box arms
+        static const FsmTable Table;
+
     public:
         PlayerArmsFsm();
         ~PlayerArmsFsm();
 
-        void initialize(Player *player);
-        void nextState(FsmResults &result);
+        // Inputs are a mask of FsmInput bits
+        void nextState(uint32_t inputs, FsmResults &result);
 
         void updateState(State state) { m_currentState = state; }
         State getState() const { return m_currentState; }
 
     protected:
-        Player *m_player;
         State m_currentState;
     };
 
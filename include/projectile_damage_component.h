@@ -1,6 +1,8 @@
 #ifndef CEREAL_ADVENTURE_PROJECTILE_DAMAGE_COMPONENT_H
 #define CEREAL_ADVENTURE_PROJECTILE_DAMAGE_COMPONENT_H
 
+#include "contact_events.h"
+
 #include "delta.h"
 
 namespace c_adv {
@@ -16,9 +18,10 @@ namespace c_adv {
         ~ProjectileDamageComponent();
 
         void initialize(Player *player);
-        void process(float dt);
 
     protected:
+        void onContact(const ContactEvent &contact);
+
         Player *m_player;
     };
 
@@ -0,0 +1,88 @@
+#ifndef CEREAL_ADVENTURE_PROJECTILE_SYSTEM_H
+#define CEREAL_ADVENTURE_PROJECTILE_SYSTEM_H
+
+#include "aabb.h"
+
+#include "delta.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+    class Realm;
+
+    struct Projectile {
+        float x = 0.0f;
+        float y = 0.0f;
+        float velocityX = 0.0f;
+        float velocityY = 0.0f;
+        float angle = 0.0f;
+        float angularVelocity = 0.0f;
+
+        float radius = 0.1f;
+        float gravity = 15.0f;
+        float lifespan = 3.0f;
+
+        // Projectiles that bounce lose their velocity along the hit normal
+        // and become harmless, otherwise they are removed on the first hit
+        bool bounce = false;
+        bool dangerous = true;
+
+        dbasic::ModelAsset *model = nullptr;
+        const ysVector *color = nullptr;
+    };
+
+    // Short-lived ballistic projectiles that don't need a rigid body. They
+    // are stored as flat arrays, integrated together and swept as circles
+    // against the static objects of a realm and its players. Dangerous hits
+    // on a player are delivered through the realm's damage queue.
+    class ProjectileSystem {
+    public:
+        static constexpr float Restitution = 0.3f;
+        static constexpr float RestSpeed = 0.5f;
+        static constexpr float SurfaceOffset = 1E-3f;
+        static constexpr float DespawnX = 500.0f;
+        static constexpr float DespawnY = 60.0f;
+
+    public:
+        ProjectileSystem();
+        ~ProjectileSystem();
+
+        void emit(const Projectile &projectile);
+        void clear();
+
+        void update(float dt, Realm *realm);
+        void render(Realm *realm, const AABB &extents);
+
+        int getCount() const { return (int)m_x.size(); }
+
+    protected:
+        void integrate(float dt);
+        void collide(Realm *realm);
+        void removeExpired();
+        void removeSwap(int index);
+
+        bool sweep(int index, const AABB &bounds, float *t, float *normalX, float *normalY) const;
+
+    protected:
+        std::vector<float> m_x, m_y;
+        std::vector<float> m_prevX, m_prevY;
+        std::vector<float> m_vx, m_vy;
+        std::vector<float> m_angle, m_angularVelocity;
+        std::vector<float> m_radius;
+        std::vector<float> m_gravity;
+        std::vector<float> m_age, m_lifespan;
+        std::vector<unsigned char> m_bounce;
+        std::vector<unsigned char> m_dangerous;
+        std::vector<unsigned char> m_dead;
+        std::vector<dbasic::ModelAsset *> m_model;
+        std::vector<ysVector4> m_color;
+
+        std::vector<GameObject *> m_targets;
+        std::vector<GameObject *> m_obstacles;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_PROJECTILE_SYSTEM_H */
@@ -1,10 +1,26 @@
 #ifndef CEREAL_ADVENTURE_REALM_H
 #define CEREAL_ADVENTURE_REALM_H
 
+#include "object_registry.h"
+#include "state_archive.h"
+#include "timer_wheel.h"
+
+#include "aabb.h"
+#include "bounds_buffer.h"
+#include "collision_matrix.h"
+#include "force_field_system.h"
+#include "game_object.h"
+#include "ledge_index.h"
+#include "mob_system.h"
+#include "projectile_system.h"
+#include "realm_snapshot.h"
+#include "spatial_grid.h"
+
 #include "delta.h"
 
 #include <vector>
 #include <queue>
+#include <unordered_map>
 
 namespace c_adv {
 
@@ -12,7 +28,31 @@ namespace c_adv {
     class World;
     class Hole;
 
+    struct PhysicsStats {
+        int substeps = 1;
+        int bodies = 0;
+        int pairs = 0;
+        int contacts = 0;
+        int islands = 0;
+    };
+
     class Realm {
+    public:
+        // Visual bounds come from collision geometry, which can be smaller
+        // than the rendered model
+        static constexpr float CullingMargin = 2.0f;
+
+        // Dynamic objects are periodically reordered by the Morton code of
+        // their position so that nearby objects are also nearby in memory
+        static constexpr int MortonSortInterval = 60;
+        static constexpr float MortonCellSize = 1.0f;
+
+        // Physics steps are split so that no moving body travels more than
+        // half of its own size, or half of the thinnest static object, in a
+        // single substep
+        static constexpr int MaxPhysicsSubsteps = 8;
+        static constexpr float MinCcdFeatureSize = 0.05f;
+
     public:
         Realm();
         ~Realm();
@@ -22,9 +62,13 @@ namespace c_adv {
         void registerGameObject(GameObject *object);
         void unregisterGameObject(GameObject *object);
 
+        // Transfers are applied in the order they were requested the next
+        // time updateRealms() is called
+        void queueTransfer(GameObject *object);
         void updateRealms();
 
         void process(float dt);
+        void updatePhysics(float dt);
         void render();
 
         bool isIndoor() const { return m_indoor; }
@@ -44,6 +88,10 @@ namespace c_adv {
             T *newObject = new (buffer) T;
             newObject->setWorld(m_world);
             newObject->setRealm(this);
+
+            // Objects spawned by another object's initialize() are recreated
+            // by that object and are not archived on their own
+            newObject->setTypeId((m_initializingObjects) ? -1 : ObjectRegistry::typeId<T>());
             addToSpawnQueue(newObject);
 
             return newObject;
@@ -52,12 +100,72 @@ namespace c_adv {
         void unload(GameObject *object);
         void respawn(GameObject *object);
 
-        void setExitPortal(GameObject *portal) { m_exitPortal = portal; }
+        void setExitPortal(GameObject *portal);
         GameObject *getExitPortal() const { return m_exitPortal; }
 
-        int getAliveObjectCount() const { return (int)m_gameObjects.size(); }
+        // Hibernation serializes every object into a compact archive and
+        // releases the physics and object memory until the realm is re-entered
+        bool canHibernate() const;
+        void hibernate();
+        void restore();
+        bool isHibernating() const { return m_hibernating; }
+
+        void updatePresence(bool present, float dt);
+
+        // Snapshots cover dynamic objects only, static objects never change.
+        // Objects spawned after the capture are deleted on restore unless
+        // something holds a reference to them.
+        void captureSnapshot(RealmSnapshot &snapshot);
+        void restoreSnapshot(RealmSnapshot &snapshot);
+
+        // Registers a dead object again without recreating it
+        void revive(GameObject *object);
+
+        GameObject *findObject(unsigned int objectId) const;
+        float getIdleTime() const { return m_idleTime; }
+
+        // Appends static objects whose bounds may overlap the query region
+        void queryStaticObjects(const AABB &bounds, std::vector<GameObject *> &objects);
+
+        // Spatial queries against visual bounds. Passing Tag::Count matches
+        // objects with any tag.
+        void overlapBox(
+            const AABB &box, std::vector<GameObject *> &objects, GameObject::Tag tag = GameObject::Tag::Count);
+        void overlapCircle(
+            const ysVector &center, float radius, std::vector<GameObject *> &objects,
+            GameObject::Tag tag = GameObject::Tag::Count);
+        GameObject *raycast(
+            const ysVector &origin, const ysVector &direction, float maxDistance, float *distance = nullptr,
+            GameObject::Tag tag = GameObject::Tag::Count);
+        GameObject *nearestWithTag(const ysVector &position, float maxDistance, GameObject::Tag tag);
+
+        // Damage is applied to its target after all objects were processed
+        void queueDamage(const DamageEvent &damage) { m_damageQueue.push_back(damage); }
+
+        ForceFieldSystem &getForceFields() { return m_forceFields; }
+        TimerWheel &getTimers() { return m_timers; }
+        ProjectileSystem &getProjectiles() { return m_projectiles; }
+        MobSystem &getMobs() { return m_mobs; }
+
+        // Appends every ledge within the given radius of the point
+        void queryLedges(const ysVector &point, float radius, std::vector<GameObject *> &ledges);
+
+        int getAliveObjectCount() const { return (int)(m_gameObjects.size() + m_staticObjects.size()); }
+        int getStaticObjectCount() const { return (int)m_staticObjects.size(); }
+
+        const BoundsBuffer &getDynamicBounds() const { return m_dynamicBounds; }
+        const BoundsBuffer &getStaticBounds();
         int getDeadObjectCount() const { return (int)m_deadObjects.size(); }
         int getVisibleObjectCount() const { return m_visibleObjectCount; }
+        // Each step picks a substep count within this range from body velocities
+        void setPhysicsSubstepRange(int minSubsteps, int maxSubsteps);
+        int getMinPhysicsSubsteps() const { return m_minPhysicsSubsteps; }
+        int getMaxPhysicsSubsteps() const { return m_maxPhysicsSubsteps; }
+
+        int getPhysicsSubsteps() const { return m_physicsStats.substeps; }
+        const PhysicsStats &getPhysicsStats() const { return m_physicsStats; }
+        CollisionMatrix &getCollisionMatrix() { return m_collisionMatrix; }
+        int getSleepingObjectCount() const { return m_sleepingObjectCount; }
 
     protected:
         void addToSpawnQueue(GameObject *object);
@@ -65,19 +173,92 @@ namespace c_adv {
         void destroyObject(GameObject *object);
 
         void initializeFrictionTable();
+        void collectContacts();
+        void dispatchContacts();
+        void dispatchDamage();
+        void discardEvents(GameObject *object);
+        void updateStaticGrid();
+        void sortDynamicObjects();
+        void updateLedgeIndex();
+        void updateSleep();
+
+        int computeTickInterval(GameObject *object, const AABB &cameraExtents) const;
+        int computePhysicsSubsteps(float dt);
+        void updatePhysicsStats();
+        int findIsland(int index);
 
     protected:
         std::queue<GameObject *> m_unloadQueue;
         std::queue<GameObject *> m_spawnQueue;
         std::queue<GameObject *> m_respawnQueue;
+        std::queue<GameObject *> m_transferQueue;
         std::vector<GameObject *> m_gameObjects;
         std::vector<GameObject *> m_deadObjects;
 
+        // Mirrors m_gameObjects, bounds are only recomputed for bodies that
+        // moved during the last physics step
+        BoundsBuffer m_dynamicBounds;
+        BoundsBuffer m_staticBounds;
+
+        std::vector<int> m_visibleIndices;
+        std::vector<int> m_queryIndices;
+        std::vector<GameObject *> m_queryResults;
+
+        std::vector<uint64_t> m_mortonKeys;
+        std::vector<int> m_sortOrder;
+        std::vector<int> m_sortScratch;
+        std::vector<GameObject *> m_sortedObjects;
+
+        // Static objects never move and are never processed, their bounds
+        // are only recomputed when the static grid is rebuilt
+        std::vector<GameObject *> m_staticObjects;
+        SpatialGrid m_staticGrid;
+        std::vector<int> m_staticQuery;
+        bool m_staticGridDirty;
+        float m_minStaticThickness;
+        std::vector<GameObject *> m_substepObstacles;
+
+        int m_sleepingObjectCount;
+        SpatialGrid m_wakeGrid;
+        std::vector<int> m_wakeQuery;
+        std::vector<unsigned char> m_wakeFlags;
+
+        // Only objects with contact listeners have their contacts gathered
+        std::vector<GameObject *> m_contactSubscribers;
+        std::vector<ContactEvent> m_contactEvents;
+        std::vector<GameObject *> m_contactScratch;
+        std::vector<DamageEvent> m_damageQueue;
+
+        std::unordered_map<unsigned int, GameObject *> m_snapshotLookup;
+
+        CollisionMatrix m_collisionMatrix;
+        ForceFieldSystem m_forceFields;
+        TimerWheel m_timers;
+        ProjectileSystem m_projectiles;
+        MobSystem m_mobs;
+
+        LedgeIndex m_ledgeIndex;
+        bool m_ledgeIndexDirty;
+
     protected:
         World *m_world;
         GameObject *m_exitPortal;
 
+        StateArchive m_hibernationArchive;
+        float m_idleTime;
+        bool m_hibernating;
+        bool m_initializingObjects;
+
+        unsigned int m_frameIndex;
+        int m_nextTickPhase;
+
         int m_visibleObjectCount;
+        int m_minPhysicsSubsteps;
+        int m_maxPhysicsSubsteps;
+
+        PhysicsStats m_physicsStats;
+        std::vector<int> m_islandParent;
+        std::vector<GameObject *> m_pairScratch;
         bool m_indoor;
     };
 
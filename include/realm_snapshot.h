@@ -0,0 +1,46 @@
+#ifndef CEREAL_ADVENTURE_REALM_SNAPSHOT_H
+#define CEREAL_ADVENTURE_REALM_SNAPSHOT_H
+
+#include "state_archive.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    // Saved state of every dynamic object in a realm. Objects that still
+    // exist when the snapshot is restored are updated in place, so restoring
+    // only costs a lookup and a state read per object.
+    class RealmSnapshot {
+    public:
+        struct Record {
+            unsigned int objectId;
+            int typeId;
+
+            // Persistent state is enough to recreate the object, runtime
+            // state is only applied to objects that are still alive
+            size_t stateOffset;
+            size_t runtimeOffset;
+        };
+
+    public:
+        RealmSnapshot();
+        ~RealmSnapshot();
+
+        void clear();
+        bool isEmpty() const { return m_records.empty(); }
+
+        StateArchive &getArchive() { return m_archive; }
+
+        void addRecord(const Record &record) { m_records.push_back(record); }
+        const std::vector<Record> &getRecords() const { return m_records; }
+
+        size_t getSize() const { return m_archive.getSize() + m_records.size() * sizeof(Record); }
+
+    protected:
+        StateArchive m_archive;
+        std::vector<Record> m_records;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_REALM_SNAPSHOT_H */
@@ -0,0 +1,44 @@
+#ifndef CEREAL_ADVENTURE_SIMD_H
+#define CEREAL_ADVENTURE_SIMD_H
+
+// Instruction set selection for hand vectorized kernels. SSE2 is always
+// available on the platforms that delta-studio supports, wider paths are
+// enabled by the compiler flags set by the CEREAL_ADVENTURE_AVX2 option.
+
+#if defined(__AVX2__)
+#define CEREAL_ADVENTURE_AVX2_ENABLED 1
+#endif
+
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define CEREAL_ADVENTURE_BMI2_ENABLED 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CEREAL_ADVENTURE_SSE_ENABLED 1
+#endif
+
+#if defined(CEREAL_ADVENTURE_AVX2_ENABLED) || defined(CEREAL_ADVENTURE_BMI2_ENABLED)
+#include <immintrin.h>
+#elif defined(CEREAL_ADVENTURE_SSE_ENABLED)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace c_adv {
+
+    inline int countTrailingZeros(unsigned int mask) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int)index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_SIMD_H */
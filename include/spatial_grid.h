@@ -0,0 +1,51 @@
+#ifndef CEREAL_ADVENTURE_SPATIAL_GRID_H
+#define CEREAL_ADVENTURE_SPATIAL_GRID_H
+
+#include "aabb.h"
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace c_adv {
+
+    // Uniform hash grid over 2D bounds. Intended for objects that are
+    // inserted once and queried often, such as static level geometry.
+    class SpatialGrid {
+    public:
+        static constexpr int MaxCellSpan = 64;
+
+    public:
+        SpatialGrid();
+        ~SpatialGrid();
+
+        void setCellSize(float cellSize) { m_cellSize = cellSize; }
+        float getCellSize() const { return m_cellSize; }
+
+        void clear();
+        void insert(int id, const AABB &bounds);
+
+        // Appends every id whose bounds may overlap the query region, each
+        // id at most once
+        void query(const AABB &bounds, std::vector<int> &ids);
+
+        int getCellCount() const { return (int)m_cells.size(); }
+
+    protected:
+        static uint64_t cellKey(int x, int y);
+        int cellCoordinate(float v) const;
+        bool getCellRange(const AABB &bounds, int *x0, int *y0, int *x1, int *y1) const;
+
+    protected:
+        std::unordered_map<uint64_t, std::vector<int>> m_cells;
+        std::vector<int> m_unbounded;
+
+        std::vector<unsigned int> m_stamps;
+        unsigned int m_currentStamp;
+
+        float m_cellSize;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_SPATIAL_GRID_H */
@@ -1,39 +1,42 @@
 #ifndef CEREAL_ADVENTURE_SPRING_CONNECTOR_H
 #define CEREAL_ADVENTURE_SPRING_CONNECTOR_H
 
-#include "delta.h"
+#include "spring_system.h"
 
 namespace c_adv {
 
+    // Handle into a shared spring pool that is integrated once per frame
+    // by updateAll()
     class SpringConnector {
+    public:
+        typedef SpringSystem::Mode Mode;
+
     public:
         SpringConnector();
+        SpringConnector(const SpringConnector &) = delete;
+        SpringConnector &operator=(const SpringConnector &) = delete;
         ~SpringConnector();
 
-        void update(float dt);
+        static void updateAll(float dt);
+        static SpringSystem &getPool();
 
-        ysVector getPosition() const { return m_position; }
-        void setPosition(const ysVector &position) { m_position = position; }
+        ysVector getPosition() const { return getPool().getPosition(m_handle); }
+        void setPosition(const ysVector &position) { getPool().setPosition(m_handle, position); }
 
-        ysVector getTarget() const { return m_target; }
-        void setTarget(const ysVector &target) { m_target = target; }
+        ysVector getTarget() const { return getPool().getTarget(m_handle); }
+        void setTarget(const ysVector &target) { getPool().setTarget(m_handle, target); }
 
-        void setStiffnessTensor(const ysVector &stiffnessTensor) { m_stiffnessTensor = stiffnessTensor; }
-        ysVector getStiffnessTensor() const { return m_stiffnessTensor; }
+        void setStiffnessTensor(const ysVector &stiffnessTensor) { getPool().setStiffness(m_handle, stiffnessTensor); }
+        ysVector getStiffnessTensor() const { return getPool().getStiffness(m_handle); }
 
-        void setDampingTensor(const ysVector &damping) { m_dampingTensor = damping; }
-        ysVector getDampingTensor() const { return m_dampingTensor; }
+        void setDampingTensor(const ysVector &damping) { getPool().setDamping(m_handle, damping); }
+        ysVector getDampingTensor() const { return getPool().getDamping(m_handle); }
 
-    protected:
-        ysVector m_position;
-        ysVector m_target;
-        ysVector m_stiffnessTensor;
-        ysVector m_dampingTensor;
+        void setMode(Mode mode) { getPool().setMode(m_handle, mode); }
+        Mode getMode() const { return getPool().getMode(m_handle); }
 
-        // Internals
     protected:
-        ysVector m_acceleration;
-        ysVector m_velocity;
+        int m_handle;
     };
 
 } /* namespace c_adv */
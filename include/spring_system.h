@@ -0,0 +1,68 @@
+#ifndef CEREAL_ADVENTURE_SPRING_SYSTEM_H
+#define CEREAL_ADVENTURE_SPRING_SYSTEM_H
+
+#include "delta.h"
+
+#include <vector>
+
+namespace c_adv {
+
+    // Pool of springs stored as contiguous aligned arrays. Every spring is
+    // integrated by a single pass over the pool in update().
+    class SpringSystem {
+    public:
+        enum class Mode {
+            // Semi-implicit Euler with a per-step velocity damping factor
+            Explicit,
+
+            // Closed form critically damped response, stable for any dt
+            CriticallyDamped
+        };
+
+    public:
+        SpringSystem();
+        ~SpringSystem();
+
+        int allocate();
+        void release(int handle);
+
+        void update(float dt);
+
+        ysVector getPosition(int handle) const { return m_position[handle]; }
+        void setPosition(int handle, const ysVector &position) { m_position[handle] = position; }
+
+        ysVector getVelocity(int handle) const { return m_velocity[handle]; }
+        void setVelocity(int handle, const ysVector &velocity) { m_velocity[handle] = velocity; }
+
+        ysVector getTarget(int handle) const { return m_target[handle]; }
+        void setTarget(int handle, const ysVector &target) { m_target[handle] = target; }
+
+        ysVector getStiffness(int handle) const { return m_stiffness[handle]; }
+        void setStiffness(int handle, const ysVector &stiffness) { m_stiffness[handle] = stiffness; }
+
+        ysVector getDamping(int handle) const { return m_damping[handle]; }
+        void setDamping(int handle, const ysVector &damping) { m_damping[handle] = damping; }
+
+        Mode getMode(int handle) const { return m_mode[handle]; }
+        void setMode(int handle, Mode mode) { m_mode[handle] = mode; }
+
+        int getActiveCount() const { return (int)(m_mode.size() - m_freeList.size()); }
+
+    protected:
+        void reserve(int capacity);
+
+    protected:
+        ysVector *m_position;
+        ysVector *m_velocity;
+        ysVector *m_target;
+        ysVector *m_stiffness;
+        ysVector *m_damping;
+        int m_capacity;
+
+        std::vector<Mode> m_mode;
+        std::vector<int> m_freeList;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_SPRING_SYSTEM_H */
@@ -0,0 +1,49 @@
+#ifndef CEREAL_ADVENTURE_STATE_ARCHIVE_H
+#define CEREAL_ADVENTURE_STATE_ARCHIVE_H
+
+#include "delta.h"
+
+#include <vector>
+#include <string.h>
+
+namespace c_adv {
+
+    class StateArchive {
+    public:
+        StateArchive();
+        ~StateArchive();
+
+        template <typename T>
+        void write(const T &value) {
+            const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&value);
+            m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        T read() {
+            T value;
+            memcpy((void *)&value, m_data.data() + m_readOffset, sizeof(T));
+            m_readOffset += sizeof(T);
+
+            return value;
+        }
+
+        void writeVector(const ysVector &v);
+        ysVector readVector();
+
+        void rewind() { m_readOffset = 0; }
+        void seek(size_t offset) { m_readOffset = offset; }
+        void clear();
+
+        bool isEmpty() const { return m_data.empty(); }
+        bool endOfArchive() const { return m_readOffset >= m_data.size(); }
+        size_t getSize() const { return m_data.size(); }
+
+    protected:
+        std::vector<unsigned char> m_data;
+        size_t m_readOffset;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_STATE_ARCHIVE_H */
@@ -14,6 +14,9 @@ namespace c_adv {
 
         virtual void render();
 
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
         void setAsset(dbasic::ModelAsset *asset) { m_asset = asset; }
         dbasic::ModelAsset *getAsset() const { return m_asset; }
 
@@ -0,0 +1,80 @@
+#ifndef CEREAL_ADVENTURE_TASK_H
+#define CEREAL_ADVENTURE_TASK_H
+
+#include "state_archive.h"
+#include "timer_wheel.h"
+
+#include <functional>
+
+// Stackless coroutines for timed sequences. A task body is written as
+//
+//     TASK_BEGIN(task);
+//     ...
+//     TASK_WAIT(task, seconds);
+//     ...
+//     TASK_END(task);
+//
+// and is resumed by the owner's realm timer wheel, so a waiting task costs
+// nothing per tick. Locals don't survive a wait; anything that has to lives
+// in the owner. Each TASK_WAIT must be on its own line.
+#define TASK_BEGIN(task) switch ((task).getLine()) { case 0:
+#define TASK_WAIT(task, delay) do { (task).wait((delay), __LINE__); return; case __LINE__:; } while (0)
+#define TASK_END(task) } (task).finish()
+
+namespace c_adv {
+
+    class GameObject;
+
+    class Task {
+    public:
+        typedef std::function<void(Task &)> Body;
+
+        static constexpr int Done = -1;
+
+    public:
+        Task();
+        ~Task();
+
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+
+        // Waits are timers of the owner, so they move with it to a new realm
+        // and are cancelled with it when it is deleted
+        void initialize(GameObject *owner, const Body &body);
+
+        // Runs the body from the top until its first wait, abandoning any
+        // wait in progress
+        void start();
+        void stop();
+        void resume();
+
+        // A task whose wait was dropped by the wheel is no longer running
+        bool isRunning() const { return m_line != Done && isWaiting(); }
+        bool isWaiting() const;
+
+        // Time left in the current wait
+        float getRemaining() const;
+
+        int getLine() const { return m_line; }
+        void wait(float delay, int line);
+        void finish();
+
+        void saveState(StateArchive &archive) const;
+        void loadState(StateArchive &archive);
+
+    protected:
+        void cancelWait();
+        TimerWheel *getWheel() const;
+
+    protected:
+        GameObject *m_owner;
+        Body m_body;
+
+        int m_line;
+
+        TimerWheel::TimerId m_timer;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_TASK_H */
@@ -0,0 +1,82 @@
+#ifndef CEREAL_ADVENTURE_TIMER_WHEEL_H
+#define CEREAL_ADVENTURE_TIMER_WHEEL_H
+
+#include <functional>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace c_adv {
+
+    class GameObject;
+
+    // Hierarchical timer wheel. Timers are bucketed by deadline so that
+    // advancing time only touches the buckets that come due, and idle
+    // timers cost nothing per tick.
+    class TimerWheel {
+    public:
+        typedef std::function<void()> Callback;
+        typedef unsigned int TimerId;
+
+        static constexpr TimerId InvalidTimer = 0;
+
+        static constexpr int Levels = 4;
+        static constexpr int SlotBits = 6;
+        static constexpr int Slots = 1 << SlotBits;
+
+    public:
+        TimerWheel();
+        ~TimerWheel();
+
+        void setTickLength(float tickLength) { m_tickLength = tickLength; }
+        float getTickLength() const { return m_tickLength; }
+
+        // Time that the wheel has been advanced by
+        float getTime() const { return m_currentTick * m_tickLength + m_accumulator; }
+
+        // Timers are owned by an object so that all of its timers can be
+        // cancelled when it is destroyed, or moved along with it when it
+        // changes realm. Ids are unique across wheels and survive a move.
+        TimerId schedule(GameObject *owner, float delay, const Callback &callback);
+        void cancel(TimerId timer);
+        void cancelAll(GameObject *owner);
+        void moveAll(GameObject *owner, TimerWheel *destination);
+        void clear();
+
+        bool isScheduled(TimerId timer) const { return m_owners.count(timer) > 0; }
+        float getRemaining(TimerId timer) const;
+        int getPendingCount() const { return (int)m_owners.size(); }
+
+        void advance(float dt);
+
+    protected:
+        struct Timer {
+            TimerId id;
+            uint64_t deadline;
+            Callback callback;
+        };
+
+        struct Owner {
+            GameObject *object;
+            uint64_t deadline;
+        };
+
+        void insert(Timer &&timer);
+        void cascade(int level);
+        void tick();
+
+    protected:
+        std::vector<Timer> m_slots[Levels][Slots];
+        std::unordered_map<TimerId, Owner> m_owners;
+        std::vector<Timer> m_due;
+
+        uint64_t m_currentTick;
+        float m_accumulator;
+        float m_tickLength;
+
+        static TimerId s_nextId;
+    };
+
+} /* namespace c_adv */
+
+#endif /* CEREAL_ADVENTURE_TIMER_WHEEL_H */
@@ -17,6 +17,9 @@ namespace c_adv {
         virtual void render();
         virtual void process(float dt);
 
+        virtual void saveState(StateArchive &archive);
+        virtual void loadState(StateArchive &archive);
+
         void setAge(float age) { m_age = age; }
         float getAge() const { return m_age; }
 
@@ -37,11 +40,8 @@ namespace c_adv {
     protected:
         float m_age;
         float m_lifespan;
-        float m_timeAsGhost;
         bool m_dangerous;
 
-        dphysics::CollisionObject *m_collisionPrimitive;
-
         // Assets ----
     public:
         void getAssets(dbasic::AssetManager *am);
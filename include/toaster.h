@@ -3,14 +3,16 @@
 
 #include "game_object.h"
 
-#include "clock.h"
-#include "cooldown_timer.h"
+#include "task.h"
 
 namespace c_adv {
 
     class Toaster : public GameObject {
     public:
         static const float ToastSpread;
+        static constexpr float FirePeriod = 10.0f;
+        static constexpr float MaxWarmup = 3.0f;
+        static constexpr float ToastRadius = 0.15f;
 
     public:
         Toaster();
@@ -19,11 +21,13 @@ namespace c_adv {
         virtual void initialize();
 
         virtual void render();
-        virtual void process(float dt);
 
     protected:
-        Clock m_clock;
-        CooldownTimer m_warmupTimer;
+        void fireLoop(Task &task);
+        void fire();
+
+    protected:
+        Task m_fireLoop;
 
         // Assets ----
     public:
@@ -32,6 +36,7 @@ namespace c_adv {
     protected:
         static dbasic::ModelAsset *m_toasterAsset;
         static dbasic::AudioAsset *m_launchAudio;
+        static dbasic::ModelAsset *m_toastAsset;
     };
 
 } /* namespace c_adv */
@@ -1,23 +1,29 @@
 #ifndef CEREAL_ADVENTURE_WAVE_GENERATOR_H
 #define CEREAL_ADVENTURE_WAVE_GENERATOR_H
 
+#include "phase_pool.h"
+
 namespace c_adv {
 
+    // Handle into a shared pool of waves that is advanced once per frame
+    // by updateAll()
     class WaveGenerator {
     public:
         WaveGenerator();
+        WaveGenerator(const WaveGenerator &) = delete;
+        WaveGenerator &operator=(const WaveGenerator &) = delete;
         ~WaveGenerator();
 
-        void update(float dt);
-        float get() const { return m_f; }
+        static void updateAll(float dt);
+        static PhasePool &getPool();
+
+        float get() const { return getPool().getValue(m_handle); }
 
-        void setPeriod(float period) { m_period = period; }
-        float getPeriod() const { return m_period; }
+        void setPeriod(float period) { getPool().setPeriod(m_handle, period); }
+        float getPeriod() const { return getPool().getPeriod(m_handle); }
 
     protected:
-        float m_timer;
-        float m_period;
-        float m_f;
+        int m_handle;
     };
 
 } /* namespace c_adv */
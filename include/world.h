@@ -2,8 +2,10 @@
 #define CEREAL_ADVENTURE_WORLD_H
 
 #include "aabb.h"
+#include "audio_system.h"
 
 #include "delta.h"
+#include "job_system.h"
 #include "realm.h"
 #include "spring_connector.h"
 #include "shaders.h"
@@ -31,6 +33,8 @@ namespace c_adv {
         dbasic::AssetManager &getAssetManager() { return m_assetManager; }
         Shaders &getShaders() { return m_shaders; }
         Ui &getUi() { return m_ui; }
+        JobSystem &getJobSystem() { return m_jobSystem; }
+        AudioSystem &getAudio() { return m_audio; }
         dbasic::ShaderSet &getShaderSet() { return m_shaderSet; }
 
         AABB getCameraExtents() const;
@@ -54,10 +58,23 @@ namespace c_adv {
         dbasic::StageEnableFlags getUiStageFlags() const { return m_uiStageFlags; }
 
         GameObject *getFocus() const { return m_focus; }
+        GameObject *findObject(unsigned int objectId) const;
+
+        void captureCheckpoint();
+        void restoreCheckpoint();
+
+        void setRealmHibernationDelay(float delay) { m_realmHibernationDelay = delay; }
+        float getRealmHibernationDelay() const { return m_realmHibernationDelay; }
+
+        // Frames longer than this are slowed down rather than stepped whole
+        void setMaxTimestep(float timestep) { m_maxTimestep = timestep; }
+        float getMaxTimestep() const { return m_maxTimestep; }
 
     protected:
         void renderUi();
         void updateRealms();
+        void updatePhysics(float dt);
+        void updateHibernation(float dt);
 
         std::vector<Realm *> m_realms;
 
@@ -65,6 +82,10 @@ namespace c_adv {
         GameObject *m_focus;
 
         ysVector m_respawnPosition;
+        RealmSnapshot m_checkpoint;
+
+        float m_realmHibernationDelay;
+        float m_maxTimestep;
 
         ysRenderTarget *m_intermediateRenderTarget;
         ysRenderTarget *m_guiRenderTarget;
@@ -73,6 +94,8 @@ namespace c_adv {
 
         Ui m_ui;
 
+        JobSystem m_jobSystem;
+
     protected:
         Shaders m_shaders;
         dbasic::DeltaEngine m_engine;
@@ -82,6 +105,9 @@ namespace c_adv {
         dbasic::Path m_assetPath;
 
         dbasic::StageEnableFlags m_uiStageFlags;
+
+        // Declared last so the audio thread stops before the engine goes away
+        AudioSystem m_audio;
     };
 
 } /* namespace c_adv */
@@ -1,23 +1,31 @@
 #ifndef CEREAL_ADVENTURE_WRAPPING_TIMER_H
 #define CEREAL_ADVENTURE_WRAPPING_TIMER_H
 
+#include "phase_pool.h"
+
 namespace c_adv {
 
+    // Handle into a shared pool of timers that is advanced once per frame
+    // by updateAll()
     class WrappingTimer {
     public:
         WrappingTimer();
+        WrappingTimer(const WrappingTimer &) = delete;
+        WrappingTimer &operator=(const WrappingTimer &) = delete;
         ~WrappingTimer();
 
-        void update(float dt);
-        float get() const { return (m_timer / m_period); }
+        static void updateAll(float dt);
+        static PhasePool &getPool();
+
+        float get() const { return getPool().getPhase(m_handle); }
 
-        void adjustPeriod(float period);
-        void setPeriod(float period) { m_period = period; }
-        float getPeriod() const { return m_period; }
+        // The phase is stored directly so changing the period keeps it
+        void adjustPeriod(float period) { getPool().setPeriod(m_handle, period); }
+        void setPeriod(float period) { getPool().setPeriod(m_handle, period); }
+        float getPeriod() const { return getPool().getPeriod(m_handle); }
 
     protected:
-        float m_timer;
-        float m_period;
+        int m_handle;
     };
 
 } /* namespace c_adv */
@@ -0,0 +1,232 @@
+#include "../include/audio_system.h"
+
+#include <algorithm>
+
+const c_adv::AudioSystem::GroupSettings c_adv::AudioSystem::Groups[] = {
+    { 2, 0.3f },    // Footsteps
+    { 2, 0.5f },    // Player
+    { 2, 0.5f },    // Damage
+    { 4, 1.0f },    // Emitter
+    { 2, 1.0f }     // Pickup
+};
+
+c_adv::AudioSystem::AudioSystem() {
+    m_engine = nullptr;
+
+    m_culledCount = 0;
+    for (int &count : m_activeVoices) count = 0;
+
+    m_time = 0.0f;
+
+    m_pendingDt = 0.0f;
+    m_listenerX = m_listenerY = 0.0f;
+
+    m_running = false;
+    m_threaded = false;
+}
+
+c_adv::AudioSystem::~AudioSystem() {
+    destroy();
+}
+
+void c_adv::AudioSystem::initialize(dbasic::DeltaEngine *engine, bool threaded) {
+    m_engine = engine;
+    m_threaded = threaded;
+
+    if (m_threaded) {
+        m_running = true;
+        m_thread = std::thread(&AudioSystem::worker, this);
+    }
+}
+
+void c_adv::AudioSystem::destroy() {
+    if (!m_thread.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_running = false;
+    }
+
+    m_requestsAvailable.notify_all();
+    m_thread.join();
+}
+
+void c_adv::AudioSystem::play(dbasic::AudioAsset *asset, AudioGroup group, int priority) {
+    if (asset == nullptr) return;
+    m_requests.push_back({ asset, group, priority, 1.0f, false, 0.0f, 0.0f });
+}
+
+void c_adv::AudioSystem::play(
+    dbasic::AudioAsset *asset, AudioGroup group, int priority, const ysVector &position)
+{
+    if (asset == nullptr) return;
+    m_requests.push_back(
+        { asset, group, priority, 1.0f, true, ysMath::GetX(position), ysMath::GetY(position) });
+}
+
+void c_adv::AudioSystem::update(float dt, float listenerX, float listenerY) {
+    if (!m_threaded) {
+        resolve(m_requests, dt, listenerX, listenerY, m_playing);
+        m_requests.clear();
+
+        playResolved(m_playing);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        // Sounds resolved since the last update are played from here
+        m_playing.commands.swap(m_results.commands);
+        m_playing.culledCount = m_results.culledCount;
+        std::copy(m_results.activeVoices, m_results.activeVoices + (int)AudioGroup::Count, m_playing.activeVoices);
+        m_results.culledCount = 0;
+
+        m_pending.insert(m_pending.end(), m_requests.begin(), m_requests.end());
+        m_pendingDt += dt;
+        m_listenerX = listenerX;
+        m_listenerY = listenerY;
+    }
+
+    m_requests.clear();
+    m_requestsAvailable.notify_one();
+
+    playResolved(m_playing);
+}
+
+void c_adv::AudioSystem::resolve(
+    std::vector<Request> &requests, float dt, float listenerX, float listenerY, Resolved &resolved)
+{
+    m_time += dt;
+    resolved.culledCount = 0;
+
+    m_voices.erase(
+        std::remove_if(m_voices.begin(), m_voices.end(), [this](const Voice &v) { return v.endTime <= m_time; }),
+        m_voices.end());
+
+    // Gain is only used to cull and rank sounds since the engine plays
+    // every sound at full volume
+    size_t n = 0;
+    for (Request &request : requests) {
+        if (request.positional) {
+            const float dx = request.x - listenerX;
+            const float dy = request.y - listenerY;
+            const float d = std::sqrt(dx * dx + dy * dy);
+
+            request.gain = 1.0f - (d - FullGainDistance) / (CullDistance - FullGainDistance);
+            request.gain = min(request.gain, 1.0f);
+        }
+
+        if (request.gain <= 0.0f) {
+            ++resolved.culledCount;
+            continue;
+        }
+
+        requests[n++] = request;
+    }
+
+    requests.resize(n);
+
+    coalesce(requests);
+
+    for (const Request &request : requests) {
+        if (allocateVoice(request)) resolved.commands.push_back(request.asset);
+        else ++resolved.culledCount;
+    }
+
+    for (int &count : resolved.activeVoices) count = 0;
+    for (const Voice &voice : m_voices) {
+        ++resolved.activeVoices[(int)voice.group];
+    }
+}
+
+void c_adv::AudioSystem::coalesce(std::vector<Request> &requests) {
+    // Keep the most important trigger of each sound, then order the
+    // survivors so that they claim voices by priority and then loudness
+    std::sort(requests.begin(), requests.end(), [](const Request &a, const Request &b) {
+        if (a.asset != b.asset) return a.asset < b.asset;
+        if (a.priority != b.priority) return a.priority > b.priority;
+        return a.gain > b.gain;
+    });
+
+    requests.erase(
+        std::unique(requests.begin(), requests.end(), [](const Request &a, const Request &b) {
+            return a.asset == b.asset;
+        }),
+        requests.end());
+
+    std::sort(requests.begin(), requests.end(), [](const Request &a, const Request &b) {
+        if (a.priority != b.priority) return a.priority > b.priority;
+        return a.gain > b.gain;
+    });
+}
+bool c_adv::AudioSystem::allocateVoice(const Request &request) {
+    const GroupSettings &settings = Groups[(int)request.group];
+    const Voice voice = { request.group, request.priority, m_time + settings.voiceLength };
+
+    int count = 0;
+    int weakest = -1;
+    for (int i = 0; i < (int)m_voices.size(); ++i) {
+        if (m_voices[i].group != request.group) continue;
+
+        ++count;
+        if (weakest == -1 || m_voices[i].priority < m_voices[weakest].priority) {
+            weakest = i;
+        }
+    }
+
+    if (count < settings.maxVoices) {
+        m_voices.push_back(voice);
+        return true;
+    }
+
+    // The engine can't stop a sound, so a stolen voice only stops counting
+    // against the cap
+    if (weakest != -1 && m_voices[weakest].priority < request.priority) {
+        m_voices[weakest] = voice;
+        return true;
+    }
+
+    return false;
+}
+
+void c_adv::AudioSystem::playResolved(Resolved &resolved) {
+    for (dbasic::AudioAsset *asset : resolved.commands) {
+        m_engine->PlayAudio(asset);
+    }
+
+    resolved.commands.clear();
+
+    m_culledCount = resolved.culledCount;
+    std::copy(resolved.activeVoices, resolved.activeVoices + (int)AudioGroup::Count, m_activeVoices);
+}
+
+void c_adv::AudioSystem::worker() {
+    while (true) {
+        float dt, listenerX, listenerY;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_requestsAvailable.wait(lock, [this] { return !m_running || m_pendingDt > 0.0f || !m_pending.empty(); });
+
+            if (!m_running) return;
+
+            m_resolving.swap(m_pending);
+            dt = m_pendingDt;
+            listenerX = m_listenerX;
+            listenerY = m_listenerY;
+            m_pendingDt = 0.0f;
+        }
+
+        resolve(m_resolving, dt, listenerX, listenerY, m_resolved);
+        m_resolving.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_results.commands.insert(m_results.commands.end(), m_resolved.commands.begin(), m_resolved.commands.end());
+            m_results.culledCount += m_resolved.culledCount;
+            std::copy(m_resolved.activeVoices, m_resolved.activeVoices + (int)AudioGroup::Count, m_results.activeVoices);
+        }
+
+        m_resolved.commands.clear();
+    }
+}
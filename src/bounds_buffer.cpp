@@ -0,0 +1,58 @@
+#include "../include/bounds_buffer.h"
+
+c_adv::BoundsBuffer::BoundsBuffer() {
+    /* void */
+}
+
+c_adv::BoundsBuffer::~BoundsBuffer() {
+    /* void */
+}
+
+void c_adv::BoundsBuffer::push(const AABB &bounds) {
+    m_minX.push_back(ysMath::GetX(bounds.minPoint));
+    m_minY.push_back(ysMath::GetY(bounds.minPoint));
+    m_maxX.push_back(ysMath::GetX(bounds.maxPoint));
+    m_maxY.push_back(ysMath::GetY(bounds.maxPoint));
+}
+
+void c_adv::BoundsBuffer::set(int index, const AABB &bounds) {
+    m_minX[index] = ysMath::GetX(bounds.minPoint);
+    m_minY[index] = ysMath::GetY(bounds.minPoint);
+    m_maxX[index] = ysMath::GetX(bounds.maxPoint);
+    m_maxY[index] = ysMath::GetY(bounds.maxPoint);
+}
+
+void c_adv::BoundsBuffer::removeSwap(int index) {
+    m_minX[index] = m_minX.back(); m_minX.pop_back();
+    m_minY[index] = m_minY.back(); m_minY.pop_back();
+    m_maxX[index] = m_maxX.back(); m_maxX.pop_back();
+    m_maxY[index] = m_maxY.back(); m_maxY.pop_back();
+}
+
+void c_adv::BoundsBuffer::clear() {
+    m_minX.clear();
+    m_minY.clear();
+    m_maxX.clear();
+    m_maxY.clear();
+}
+
+void c_adv::BoundsBuffer::permute(const std::vector<int> &order) {
+    std::vector<float> *arrays[] = { &m_minX, &m_minY, &m_maxX, &m_maxY };
+
+    const int N = (int)order.size();
+    m_scratch.resize(N);
+
+    for (std::vector<float> *a : arrays) {
+        for (int i = 0; i < N; ++i) {
+            m_scratch[i] = (*a)[order[i]];
+        }
+
+        a->swap(m_scratch);
+    }
+}
+
+c_adv::AABB c_adv::BoundsBuffer::get(int index) const {
+    return {
+        ysMath::LoadVector(m_minX[index], m_minY[index], 0.0f, 1.0f),
+        ysMath::LoadVector(m_maxX[index], m_maxY[index], 0.0f, 1.0f) };
+}
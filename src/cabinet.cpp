@@ -16,7 +16,9 @@ c_adv::Cabinet::~Cabinet() {
 void c_adv::Cabinet::initialize() {
     GameObject::initialize();
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    addTag(Tag::Static);
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
 
     dphysics::CollisionObject *bounds;
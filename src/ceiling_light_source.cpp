@@ -14,7 +14,9 @@ c_adv::CeilingLightSource::~CeilingLightSource() {
 void c_adv::CeilingLightSource::initialize() {
     GameObject::initialize();
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    addTag(Tag::Static);
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
 }
 
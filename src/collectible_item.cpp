@@ -6,6 +6,8 @@
 c_adv::CollectibleItem::CollectibleItem() {
     m_asset = nullptr;
     m_glowColor = ysMath::Constants::One;
+
+    setTickLodEnabled(true);
 }
 
 c_adv::CollectibleItem::~CollectibleItem() {
@@ -15,8 +17,7 @@ c_adv::CollectibleItem::~CollectibleItem() {
 void c_adv::CollectibleItem::initialize() {
     GameObject::initialize();
 
-    m_collectionTimer.setCooldownPeriod(0.3f);
-    m_collectionTimer.disable();
+    m_collection.initialize(this, [this](Task &task) { collectionSequence(task); });
 
     m_emissionWave.setPeriod(1.0f);
     m_spinTimer.setPeriod(3.0f);
@@ -27,19 +28,37 @@ void c_adv::CollectibleItem::initialize() {
 
     RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
     RigidBody.SetInverseMass(0.0f);
-    RigidBody.SetAlwaysAwake(true);
-    RigidBody.SetRequestsInformation(true);
-
-    dphysics::CollisionObject *bounds;
-    RigidBody.CollisionGeometry.NewCircleObject(&bounds);
-    bounds->SetMode(dphysics::CollisionObject::Mode::Sensor);
-    bounds->GetAsCircle()->Position = ysMath::Constants::Zero;
-    bounds->GetAsCircle()->Radius = 4.0f;
-    
+    RigidBody.SetAlwaysAwake(false);
+    RigidBody.SetRequestsInformation(false);
+
+    setBoundsRadius(1.0f);
+    setWakeRadius(3.0f);
+
     m_audio = m_world->getAssetManager().GetAudioAsset("Collection::Mysterious");
 }
 
+void c_adv::CollectibleItem::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_asset);
+    archive.writeVector(m_glowColor);
+}
+
+void c_adv::CollectibleItem::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_asset = archive.read<dbasic::ModelAsset *>();
+    m_glowColor = archive.readVector();
+}
+
 void c_adv::CollectibleItem::render() {
+    const float collectionProgress = getCollectionProgress();
+
+    // The item spins up as it fades out
+    if (collectionProgress > 0.0f) {
+        m_spinTimer.setPeriod(3.0f * (1 - collectionProgress + 0.01f));
+    }
+
     const ysVector rotationAxis = ysMath::Normalize(ysMath::LoadVector(
         m_rAxis_x.get(),
         1.0f,
@@ -60,10 +79,6 @@ void c_adv::CollectibleItem::render() {
         )
     );
 
-    const float collectionProgress = m_collectionTimer.active()
-        ? m_collectionTimer.get()
-        : 0.0f;
-
     const float glow = 0.5f * (m_floatWave.get() + 1);
     const float collectionGlow = std::sin(collectionProgress * collectionProgress * ysMath::Constants::PI);
 
@@ -88,49 +103,36 @@ void c_adv::CollectibleItem::render() {
 void c_adv::CollectibleItem::process(float dt) {
     GameObject::process(dt);
 
-    m_collectionTimer.update(dt);
+    collidingWithPlayerCheck();
+}
 
-    m_emissionWave.update(dt);
-    m_floatWave.update(dt);
-    m_spinTimer.update(dt);
+void c_adv::CollectibleItem::collidingWithPlayerCheck() {
+    if (m_collection.isRunning() || getDeletionFlag()) return;
 
-    m_rAxis_x.update(dt);
-    m_rAxis_z.update(dt);
+    GameObject *player = m_realm->nearestWithTag(
+        RigidBody.Transform.GetWorldPosition(), 2.0f, Tag::Player);
 
-    if (m_collectionTimer.ready()) {
-        setDeletionFlag();
-    }
-    else if (m_collectionTimer.active()) {
-        m_spinTimer.setPeriod(3.0f * (1 - m_collectionTimer.get() + 0.01));
+    if (player != nullptr && !player->inGraceMode()) {
+        m_collection.start();
     }
+}
 
-    collidingWithPlayerCheck();
+void c_adv::CollectibleItem::collectionSequence(Task &task) {
+    TASK_BEGIN(task);
+
+    m_world->getAudio().play(
+        m_audio, AudioGroup::Pickup, 1, RigidBody.Transform.GetWorldPosition());
+
+    TASK_WAIT(task, CollectionTime);
+
+    setDeletionFlag();
+
+    TASK_END(task);
 }
 
-void c_adv::CollectibleItem::collidingWithPlayerCheck() {
-    if (m_collectionTimer.enabled()) return;
-
-    bool collidingWithPlayer = false;
-    const int collisionCount = RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *col = RigidBody.GetCollision(i);
-        if (!getCollidingObject(col)->hasTag(Tag::Player)) continue;
-
-        GameObject *player = getCollidingObject(col);
-        if (col->m_sensor && !col->IsGhost()) {
-            if (inRange(
-                player->RigidBody.Transform.GetWorldPosition(),
-                RigidBody.Transform.GetWorldPosition(),
-                2.0))
-            {
-                collidingWithPlayer = true;
-                break;
-            }
-        }
-    }
+float c_adv::CollectibleItem::getCollectionProgress() {
+    if (getDeletionFlag()) return 1.0f;
+    else if (!m_collection.isWaiting()) return 0.0f;
 
-    if (collidingWithPlayer) {
-        m_collectionTimer.trigger();
-        m_world->getEngine().PlayAudio(m_audio);
-    }
+    return 1.0f - m_collection.getRemaining() / CollectionTime;
 }
@@ -0,0 +1,69 @@
+#include "../include/collision_matrix.h"
+
+namespace c_adv {
+
+    struct LayerPair {
+        GameObject::Layer a;
+        GameObject::Layer b;
+    };
+
+    // Pairs that never need narrowphase, every other pair collides
+    static constexpr LayerPair DefaultFilteredPairs[] = {
+        { GameObject::Layer::Static, GameObject::Layer::Static },
+        { GameObject::Layer::Static, GameObject::Layer::Emitter },
+        { GameObject::Layer::Emitter, GameObject::Layer::Emitter },
+        { GameObject::Layer::Emitter, GameObject::Layer::Projectile },
+        { GameObject::Layer::Projectile, GameObject::Layer::Projectile }
+    };
+
+} /* namespace c_adv */
+
+c_adv::CollisionMatrix::CollisionMatrix() {
+    reset();
+}
+
+c_adv::CollisionMatrix::~CollisionMatrix() {
+    /* void */
+}
+
+void c_adv::CollisionMatrix::reset() {
+    for (int i = 0; i < MaxLayers; ++i) {
+        m_masks[i] = 0xFFFFFFFF;
+    }
+
+    for (const LayerPair &pair : DefaultFilteredPairs) {
+        setCollides(pair.a, pair.b, false);
+    }
+}
+
+void c_adv::CollisionMatrix::setCollides(GameObject::Layer a, GameObject::Layer b, bool collides) {
+    const int i = (int)a, j = (int)b;
+
+    if (collides) {
+        m_masks[i] |= (1u << j);
+        m_masks[j] |= (1u << i);
+    }
+    else {
+        m_masks[i] &= ~(1u << j);
+        m_masks[j] &= ~(1u << i);
+    }
+}
+
+bool c_adv::CollisionMatrix::collides(GameObject::Layer a, GameObject::Layer b) const {
+    return (m_masks[(int)a] & (1u << (int)b)) != 0;
+}
+
+void c_adv::CollisionMatrix::apply(GameObject *object) const {
+    const int layer = (int)object->getCollisionLayer();
+    const uint32_t mask = m_masks[layer];
+
+    const int n = object->RigidBody.CollisionGeometry.GetNumObjects();
+    for (int i = 0; i < n; ++i) {
+        dphysics::CollisionObject *collisionObject = object->RigidBody.CollisionGeometry.GetCollisionObject(i);
+        collisionObject->SetLayer(layer);
+
+        for (int j = 0; j < MaxLayers; ++j) {
+            collisionObject->SetCollidesWith(j, (mask & (1u << j)) != 0);
+        }
+    }
+}
@@ -28,3 +28,15 @@ void c_adv::CooldownTimer::update(float dt) {
         m_timer = m_cooldownPeriod;
     }
 }
+
+void c_adv::CooldownTimer::saveState(StateArchive &archive) const {
+    archive.write(m_timer);
+    archive.write(m_triggered);
+    archive.write(m_enabled);
+}
+
+void c_adv::CooldownTimer::loadState(StateArchive &archive) {
+    m_timer = archive.read<float>();
+    m_triggered = archive.read<bool>();
+    m_enabled = archive.read<bool>();
+}
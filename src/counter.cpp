@@ -16,7 +16,9 @@ c_adv::Counter::~Counter() {
 void c_adv::Counter::initialize() {
     GameObject::initialize();
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    addTag(Tag::Static);
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
     RigidBody.SetMaterial(GenericFrictionMaterial);
 
@@ -0,0 +1,100 @@
+#include "../include/culling.h"
+
+#include "../include/simd.h"
+
+void c_adv::cullBounds(
+    const BoundsBuffer &bounds, const AABB &extents, std::vector<int> &visible, int indexOffset)
+{
+    cullBounds(
+        bounds.minX(), bounds.minY(), bounds.maxX(), bounds.maxY(), bounds.size(),
+        extents, visible, indexOffset);
+}
+
+void c_adv::cullBounds(
+    const float *minX, const float *minY, const float *maxX, const float *maxY, int count,
+    const AABB &extents, std::vector<int> &visible, int indexOffset)
+{
+    const float e_minX = ysMath::GetX(extents.minPoint), e_minY = ysMath::GetY(extents.minPoint);
+    const float e_maxX = ysMath::GetX(extents.maxPoint), e_maxY = ysMath::GetY(extents.maxPoint);
+
+    int i = 0;
+
+#if defined(CEREAL_ADVENTURE_AVX2_ENABLED)
+    const __m256 c_minX = _mm256_set1_ps(e_minX), c_minY = _mm256_set1_ps(e_minY);
+    const __m256 c_maxX = _mm256_set1_ps(e_maxX), c_maxY = _mm256_set1_ps(e_maxY);
+
+    for (; i + 8 <= count; i += 8) {
+        // A box is rejected if it is entirely to one side of the extents
+        const __m256 outside = _mm256_or_ps(
+            _mm256_or_ps(
+                _mm256_cmp_ps(_mm256_loadu_ps(maxX + i), c_minX, _CMP_LT_OQ),
+                _mm256_cmp_ps(_mm256_loadu_ps(minX + i), c_maxX, _CMP_GT_OQ)),
+            _mm256_or_ps(
+                _mm256_cmp_ps(_mm256_loadu_ps(maxY + i), c_minY, _CMP_LT_OQ),
+                _mm256_cmp_ps(_mm256_loadu_ps(minY + i), c_maxY, _CMP_GT_OQ)));
+
+        unsigned int mask = ~(unsigned int)_mm256_movemask_ps(outside) & 0xFF;
+        while (mask != 0) {
+            visible.push_back(indexOffset + i + countTrailingZeros(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+#if defined(CEREAL_ADVENTURE_SSE_ENABLED)
+    const __m128 s_minX = _mm_set1_ps(e_minX), s_minY = _mm_set1_ps(e_minY);
+    const __m128 s_maxX = _mm_set1_ps(e_maxX), s_maxY = _mm_set1_ps(e_maxY);
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 outside = _mm_or_ps(
+            _mm_or_ps(
+                _mm_cmplt_ps(_mm_loadu_ps(maxX + i), s_minX),
+                _mm_cmpgt_ps(_mm_loadu_ps(minX + i), s_maxX)),
+            _mm_or_ps(
+                _mm_cmplt_ps(_mm_loadu_ps(maxY + i), s_minY),
+                _mm_cmpgt_ps(_mm_loadu_ps(minY + i), s_maxY)));
+
+        unsigned int mask = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+        while (mask != 0) {
+            visible.push_back(indexOffset + i + countTrailingZeros(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    cullBoundsScalar(
+        minX + i, minY + i, maxX + i, maxY + i, count - i, extents, visible, indexOffset + i);
+}
+
+void c_adv::cullBoundsScalar(
+    const float *minX, const float *minY, const float *maxX, const float *maxY, int count,
+    const AABB &extents, std::vector<int> &visible, int indexOffset)
+{
+    const float e_minX = ysMath::GetX(extents.minPoint), e_minY = ysMath::GetY(extents.minPoint);
+    const float e_maxX = ysMath::GetX(extents.maxPoint), e_maxY = ysMath::GetY(extents.maxPoint);
+
+    for (int i = 0; i < count; ++i) {
+        if (maxX[i] < e_minX || minX[i] > e_maxX) continue;
+        if (maxY[i] < e_minY || minY[i] > e_maxY) continue;
+
+        visible.push_back(indexOffset + i);
+    }
+}
+
+c_adv::CullingPath c_adv::getCullingPath() {
+#if defined(CEREAL_ADVENTURE_AVX2_ENABLED)
+    return CullingPath::Avx2;
+#elif defined(CEREAL_ADVENTURE_SSE_ENABLED)
+    return CullingPath::Sse;
+#else
+    return CullingPath::Scalar;
+#endif
+}
+
+const char *c_adv::getCullingPathName(CullingPath path) {
+    switch (path) {
+    case CullingPath::Avx2: return "AVX2";
+    case CullingPath::Sse: return "SSE";
+    default: return "Scalar";
+    }
+}
@@ -15,24 +15,36 @@ c_adv::DeathComponent::~DeathComponent() {
 void c_adv::DeathComponent::initialize(Player *player) {
     m_player = player;
 
-    m_afterDeathCooldown.setCooldownPeriod(AfterDeathSequenceLength);
-    m_afterDeathCooldown.disable();
+    m_afterDeathSequence.initialize(player, [this](Task &task) { afterDeathSequence(task); });
 }
 
 void c_adv::DeathComponent::process(float dt) {
-    m_afterDeathCooldown.update(dt);
-
-    if (m_afterDeathCooldown.ready()) {
-        m_afterDeathCooldown.disable();
-
+    if (ysMath::GetY(m_player->RigidBody.Transform.GetWorldPosition()) < -5.0f) {
         m_player->setDeletionFlag();
     }
+}
 
-    if (!m_player->isAlive() && !m_player->getDeletionFlag()) {
-        m_afterDeathCooldown.trigger();
-    }
+void c_adv::DeathComponent::onDeath() {
+    if (!m_afterDeathSequence.isRunning()) m_afterDeathSequence.start();
+}
 
-    if (ysMath::GetY(m_player->RigidBody.Transform.GetWorldPosition()) < -5.0f) {
-        m_player->setDeletionFlag();
-    }
+void c_adv::DeathComponent::reset() {
+    m_afterDeathSequence.stop();
+}
+
+void c_adv::DeathComponent::saveState(StateArchive &archive) const {
+    m_afterDeathSequence.saveState(archive);
+}
+
+void c_adv::DeathComponent::loadState(StateArchive &archive) {
+    m_afterDeathSequence.loadState(archive);
+}
+
+void c_adv::DeathComponent::afterDeathSequence(Task &task) {
+    TASK_BEGIN(task);
+
+    TASK_WAIT(task, AfterDeathSequenceLength);
+    m_player->setDeletionFlag();
+
+    TASK_END(task);
 }
@@ -48,9 +48,6 @@ void c_adv::DebugCameraController::render() {
 }
 
 void c_adv::DebugCameraController::process(float dt) {
-    m_smoothCamera.update(dt);
-    m_smoothTarget.update(dt);
-
     if (m_world->getEngine().IsKeyDown(ysKey::Code::Subtract)) {
         m_cameraDistance += 0.5f;
     }
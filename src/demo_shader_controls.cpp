@@ -69,7 +69,6 @@ void c_adv::DemoShaderControls::process(float dt) {
             ? ysMath::Constants::One
             : ysMath::Constants::Zero;
         m_connectors[i].setTarget(value);
-        m_connectors[i].update(dt);
     }
 }
 
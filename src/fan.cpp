@@ -18,16 +18,14 @@ void c_adv::Fan::initialize() {
 
     RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
     RigidBody.SetInverseMass(0.0f);
-    RigidBody.SetAlwaysAwake(true);
-    RigidBody.SetRequestsInformation(true);
+    RigidBody.SetAlwaysAwake(false);
+    RigidBody.SetRequestsInformation(false);
 
-    dphysics::CollisionObject *bounds;
-    RigidBody.CollisionGeometry.NewCircleObject(&bounds);
-    bounds->SetMode(dphysics::CollisionObject::Mode::Sensor);
-    bounds->GetAsCircle()->Radius = 4.0f;
-    bounds->GetAsCircle()->Position = ysMath::Constants::Zero;
-    bounds->SetRelativePosition(ysMath::LoadVector(4.0f, 0.0f, 0.0f));
+    setWakeRegion({
+        ysMath::LoadVector(-2.0f, -2.5f, 0.0f, 0.0f),
+        ysMath::LoadVector(9.0f, 2.5f, 0.0f, 0.0f) });
 
+    dphysics::CollisionObject *bounds;
     RigidBody.CollisionGeometry.NewBoxObject(&bounds);
     bounds->SetMode(dphysics::CollisionObject::Mode::Fine);
     bounds->GetAsBox()->HalfWidth = 2.3f / 2;
@@ -46,30 +44,26 @@ void c_adv::Fan::render() {
 void c_adv::Fan::process(float dt) {
     GameObject::process(dt);
 
-    int collisionCount = RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *col = RigidBody.GetCollision(i);
-
-        if (col->m_sensor) {
-            GameObject *obj = getCollidingObject(col);
-
-            const ysVector position = RigidBody.Transform.GetWorldPosition();
-            const ysVector objPosition = obj->RigidBody.Transform.GetWorldPosition();
-
-            const float obj_x = ysMath::GetX(objPosition);
-            const float obj_y = ysMath::GetY(objPosition);
-            const float fan_x = ysMath::GetX(position);
-            const float fan_y = ysMath::GetY(position);
-
-            if (std::abs(obj_y - fan_y) < 1.5f && obj_x > fan_x) {
-                if (!obj->hasTag(GameObject::Tag::Dynamic)) continue;
-                if (ysMath::GetX(obj->RigidBody.GetVelocity()) > 15.0f) continue;
-
-                obj->RigidBody.AddForceLocalSpace(
-                    ysMath::LoadVector(20.0f, 10.0f, 0.0f), ysMath::Constants::Zero);
-            }
-        }
-    }
+    // The field blows along the fan's local x axis
+    const ysVector center = RigidBody.Transform.LocalToWorldSpace(ysMath::LoadVector(4.0f, 0.0f, 0.0f));
+    const ysVector4 axis = ysMath::GetVector4(RigidBody.Transform.LocalToWorldDirection(ysMath::Constants::XAxis));
+    const ysVector4 up = ysMath::GetVector4(RigidBody.Transform.LocalToWorldDirection(ysMath::Constants::YAxis));
+
+    ForceField field;
+    field.shape = ForceField::Shape::Box;
+    field.x = ysMath::GetX(center);
+    field.y = ysMath::GetY(center);
+    field.axisX = axis.x;
+    field.axisY = axis.y;
+    field.halfWidth = 4.0f;
+    field.halfHeight = 1.5f;
+    field.directionX = axis.x;
+    field.directionY = axis.y;
+    field.forceX = 20.0f * axis.x + 10.0f * up.x;
+    field.forceY = 20.0f * axis.y + 10.0f * up.y;
+    field.maxVelocity = 15.0f;
+
+    m_realm->getForceFields().setField(this, field);
 }
 
 void c_adv::Fan::getAssets(dbasic::AssetManager *am) {
@@ -2,6 +2,7 @@
 
 #include "../include/player.h"
 #include "../include/oven.h"
+#include "../include/realm.h"
 
 c_adv::FireDamageComponent::FireDamageComponent() {
     m_player = nullptr;
@@ -15,42 +16,21 @@ void c_adv::FireDamageComponent::initialize(Player *player) {
     m_fireDamageCooldown.setCooldownPeriod(1.0f);
 
     m_player = player;
+    m_player->addContactListener([this](const ContactEvent &contact) { onContact(contact); });
 }
 
 void c_adv::FireDamageComponent::process(float dt) {
     m_fireDamageCooldown.update(dt);
+}
 
+void c_adv::FireDamageComponent::onContact(const ContactEvent &contact) {
     if (!m_fireDamageCooldown.ready()) return;
+    if (!contact.other->hasTag(GameObject::Tag::Oven)) return;
 
-    ysVector collisionPosition;
-    GameObject *object = getCollidingOven(collisionPosition);
-
-    if (object != nullptr) {
-        Oven *oven = static_cast<Oven *>(object);
-        bool dangerousPosition = oven->isDangerous(collisionPosition);
-
-        if (dangerousPosition && oven->isHot()) {
-            m_player->RigidBody.AddImpulseWorldSpace(
-                ysMath::LoadVector(0.0f, 5.0f, 0.0f), m_player->RigidBody.Transform.GetWorldPosition());
-
-            m_player->takeDamage(1.0f);
-            m_fireDamageCooldown.trigger();
-        }
+    Oven *oven = static_cast<Oven *>(contact.other);
+    if (oven->isDangerous(contact.position) && oven->isHot()) {
+        m_player->getRealm()->queueDamage(
+            { oven, m_player, 1.0f, ysMath::LoadVector(0.0f, 5.0f, 0.0f) });
+        m_fireDamageCooldown.trigger();
     }
 }
-
-c_adv::GameObject *c_adv::FireDamageComponent::getCollidingOven(ysVector &position) {
-    int collisionCount = m_player->RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *collision = m_player->RigidBody.GetCollision(i);
-        if (!collision->m_sensor && !collision->IsGhost()) {
-            GameObject *object = m_player->getCollidingObject(collision);
-            if (object->hasTag(GameObject::Tag::Oven)) {
-                position = collision->m_position;
-                return object;
-            }
-        }
-    }
-
-    return nullptr;
-}
@@ -0,0 +1,181 @@
+#include "../include/force_field_system.h"
+
+#include "../include/game_object.h"
+#include "../include/realm.h"
+
+#include <cmath>
+
+c_adv::ForceFieldSystem::ForceFieldSystem() {
+    /* void */
+}
+
+c_adv::ForceFieldSystem::~ForceFieldSystem() {
+    /* void */
+}
+
+void c_adv::ForceFieldSystem::setField(GameObject *owner, const ForceField &field) {
+    auto entry = m_fieldIndex.find(owner);
+    if (entry != m_fieldIndex.end()) {
+        m_fields[entry->second] = field;
+        return;
+    }
+
+    m_fieldIndex[owner] = (int)m_fields.size();
+    m_fields.push_back(field);
+    m_owners.push_back(owner);
+}
+
+void c_adv::ForceFieldSystem::removeField(GameObject *owner) {
+    auto entry = m_fieldIndex.find(owner);
+    if (entry == m_fieldIndex.end()) return;
+
+    const int index = entry->second;
+    m_fieldIndex.erase(entry);
+
+    m_fields[index] = m_fields.back(); m_fields.pop_back();
+    m_owners[index] = m_owners.back(); m_owners.pop_back();
+
+    if (index < (int)m_owners.size()) {
+        m_fieldIndex[m_owners[index]] = index;
+    }
+}
+
+void c_adv::ForceFieldSystem::clear() {
+    m_fields.clear();
+    m_owners.clear();
+    m_fieldIndex.clear();
+}
+
+void c_adv::ForceFieldSystem::apply(Realm *realm) {
+    for (const ForceField &field : m_fields) {
+        gather(realm, field);
+        if (m_bodies.empty()) continue;
+
+        switch (field.shape) {
+        case ForceField::Shape::Box: evaluateBox(field); break;
+        case ForceField::Shape::Circle: evaluateCircle(field); break;
+        case ForceField::Shape::Cone: evaluateCone(field); break;
+        }
+
+        const int N = (int)m_bodies.size();
+        for (int i = 0; i < N; ++i) {
+            if (m_fx[i] == 0.0f && m_fy[i] == 0.0f) continue;
+
+            m_bodies[i]->RigidBody.AddForceLocalSpace(
+                ysMath::LoadVector(m_fx[i], m_fy[i], 0.0f), ysMath::Constants::Zero);
+        }
+    }
+}
+
+void c_adv::ForceFieldSystem::gather(Realm *realm, const ForceField &field) {
+    float extentX, extentY;
+    if (field.shape == ForceField::Shape::Box) {
+        extentX = std::abs(field.axisX) * field.halfWidth + std::abs(field.axisY) * field.halfHeight;
+        extentY = std::abs(field.axisY) * field.halfWidth + std::abs(field.axisX) * field.halfHeight;
+    }
+    else {
+        extentX = extentY = field.radius;
+    }
+
+    m_bodies.clear();
+    realm->overlapBox(
+        {
+            ysMath::LoadVector(field.x - extentX, field.y - extentY, 0.0f, 1.0f),
+            ysMath::LoadVector(field.x + extentX, field.y + extentY, 0.0f, 1.0f) },
+        m_bodies,
+        GameObject::Tag::Dynamic);
+
+    const int N = (int)m_bodies.size();
+    m_px.resize(N); m_py.resize(N);
+    m_vx.resize(N); m_vy.resize(N);
+    m_fx.resize(N); m_fy.resize(N);
+
+    for (int i = 0; i < N; ++i) {
+        const ysVector4 p = ysMath::GetVector4(m_bodies[i]->RigidBody.Transform.GetWorldPosition());
+        const ysVector4 v = ysMath::GetVector4(m_bodies[i]->RigidBody.GetVelocity());
+
+        m_px[i] = p.x; m_py[i] = p.y;
+        m_vx[i] = v.x; m_vy[i] = v.y;
+    }
+}
+
+void c_adv::ForceFieldSystem::evaluateBox(const ForceField &field) {
+    const int N = (int)m_bodies.size();
+
+    const float range = std::sqrt(field.halfWidth * field.halfWidth + field.halfHeight * field.halfHeight);
+    const float falloff = (range > 0) ? field.falloff / range : 0.0f;
+
+    float *fx = m_fx.data(), *fy = m_fy.data();
+    const float *px = m_px.data(), *py = m_py.data();
+    const float *vx = m_vx.data(), *vy = m_vy.data();
+
+    for (int i = 0; i < N; ++i) {
+        const float dx = px[i] - field.x;
+        const float dy = py[i] - field.y;
+
+        // Offset in the box's frame
+        const float u = dx * field.axisX + dy * field.axisY;
+        const float v = dy * field.axisX - dx * field.axisY;
+        const float d = std::sqrt(dx * dx + dy * dy);
+
+        const float speed = vx[i] * field.directionX + vy[i] * field.directionY;
+        const float scale = max(1.0f - falloff * d, 0.0f);
+        const bool active = std::abs(u) <= field.halfWidth && std::abs(v) <= field.halfHeight
+            && speed <= field.maxVelocity;
+        const float mask = active ? scale : 0.0f;
+
+        fx[i] = field.forceX * mask;
+        fy[i] = field.forceY * mask;
+    }
+}
+
+void c_adv::ForceFieldSystem::evaluateCircle(const ForceField &field) {
+    const int N = (int)m_bodies.size();
+
+    const float falloff = (field.radius > 0) ? field.falloff / field.radius : 0.0f;
+    const float r2 = field.radius * field.radius;
+
+    float *fx = m_fx.data(), *fy = m_fy.data();
+    const float *px = m_px.data(), *py = m_py.data();
+    const float *vx = m_vx.data(), *vy = m_vy.data();
+
+    for (int i = 0; i < N; ++i) {
+        const float dx = px[i] - field.x;
+        const float dy = py[i] - field.y;
+        const float d2 = dx * dx + dy * dy;
+
+        const float speed = vx[i] * field.directionX + vy[i] * field.directionY;
+        const float scale = max(1.0f - falloff * std::sqrt(d2), 0.0f);
+        const float mask = (d2 <= r2 && speed <= field.maxVelocity) ? scale : 0.0f;
+
+        fx[i] = field.forceX * mask;
+        fy[i] = field.forceY * mask;
+    }
+}
+
+void c_adv::ForceFieldSystem::evaluateCone(const ForceField &field) {
+    const int N = (int)m_bodies.size();
+
+    const float falloff = (field.radius > 0) ? field.falloff / field.radius : 0.0f;
+    const float r2 = field.radius * field.radius;
+
+    float *fx = m_fx.data(), *fy = m_fy.data();
+    const float *px = m_px.data(), *py = m_py.data();
+    const float *vx = m_vx.data(), *vy = m_vy.data();
+
+    for (int i = 0; i < N; ++i) {
+        const float dx = px[i] - field.x;
+        const float dy = py[i] - field.y;
+        const float d2 = dx * dx + dy * dy;
+        const float d = std::sqrt(d2);
+
+        const float along = dx * field.directionX + dy * field.directionY;
+        const float speed = vx[i] * field.directionX + vy[i] * field.directionY;
+        const float scale = max(1.0f - falloff * d, 0.0f);
+        const bool active = d2 <= r2 && along >= field.cosHalfAngle * d && speed <= field.maxVelocity;
+        const float mask = active ? scale : 0.0f;
+
+        fx[i] = field.forceX * mask;
+        fy[i] = field.forceY * mask;
+    }
+}
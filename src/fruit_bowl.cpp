@@ -2,7 +2,6 @@
 
 #include "../include/world.h"
 #include "../include/colors.h"
-#include "../include/fruit_projectile.h"
 
 dbasic::RenderSkeleton *c_adv::FruitBowl::s_fruitBowl = nullptr;
 dbasic::ModelAsset *c_adv::FruitBowl::s_apple = nullptr;
@@ -30,11 +29,23 @@ void c_adv::FruitBowl::initialize() {
     bounds->GetAsBox()->HalfWidth = 1.7f / 2;
     bounds->GetAsBox()->Orientation = ysMath::Constants::QuatIdentity;
     bounds->GetAsBox()->Position = ysMath::Constants::Zero;
+    setCollisionLayer(Layer::Emitter);
 
     m_renderTransform.SetParent(&RigidBody.Transform);
 
-    m_clock.setHighTime(1.0f);
-    m_clock.setLowTime(10.0f);
+    m_realm->getTimers().schedule(this, FirePeriod, [this]() { fire(); });
+}
+
+void c_adv::FruitBowl::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.writeVector(m_renderTransform.GetOrientationParentSpace());
+}
+
+void c_adv::FruitBowl::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    setOrientation(archive.readVector());
 }
 
 void c_adv::FruitBowl::render() {
@@ -49,28 +60,27 @@ void c_adv::FruitBowl::render() {
         (int)Layer::Items);
 }
 
-void c_adv::FruitBowl::process(float dt) {
-    m_clock.update(dt);
-
-    if (m_clock.getState()) {
-        dbasic::ModelAsset *types[] = { s_apple, s_banana, s_pear };
-        dbasic::ModelAsset *projectileType = types[ysMath::UniformRandomInt(3)];
-
-        FruitProjectile *projectile = getRealm()->spawn<FruitProjectile>();
-        projectile->setAsset(projectileType);
-        projectile->RigidBody.Transform.SetPosition(
-            ysMath::Add(RigidBody.Transform.GetWorldPosition(), ysMath::LoadVector(0.0f, 1.0f, 0.0f))
-        );
-        projectile->RigidBody.SetAngularVelocity(ysMath::LoadVector(0.0f, 0.0f, ysMath::UniformRandom(20.0f)));
-
-        const float angle = ysMath::UniformRandom() * ysMath::Constants::PI;
-        const float velocity = ysMath::UniformRandom() * 10.0f + 5.0f;
-
-        projectile->RigidBody.SetVelocity(
-            ysMath::LoadVector(cos(angle) * velocity, sin(angle) * velocity, 0.0f));
-
-        m_clock.reset();
-    }
+void c_adv::FruitBowl::fire() {
+    dbasic::ModelAsset *types[] = { s_apple, s_banana, s_pear };
+    dbasic::ModelAsset *projectileType = types[ysMath::UniformRandomInt(3)];
+
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    const float angle = ysMath::UniformRandom() * ysMath::Constants::PI;
+    const float velocity = ysMath::UniformRandom() * 10.0f + 5.0f;
+
+    Projectile fruit;
+    fruit.x = ysMath::GetX(position);
+    fruit.y = ysMath::GetY(position) + 1.0f;
+    fruit.velocityX = cos(angle) * velocity;
+    fruit.velocityY = sin(angle) * velocity;
+    fruit.angularVelocity = ysMath::UniformRandom(20.0f);
+    fruit.radius = FruitRadius;
+    fruit.lifespan = 10.0f;
+    fruit.model = projectileType;
+    fruit.color = &Black;
+    m_realm->getProjectiles().emit(fruit);
+
+    m_realm->getTimers().schedule(this, FirePeriod, [this]() { fire(); });
 }
 
 void c_adv::FruitBowl::getAssets(dbasic::AssetManager *am) {
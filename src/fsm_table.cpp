@@ -0,0 +1,45 @@
+#include "../include/fsm_table.h"
+
+void c_adv::FsmOutputs::resize(int count) {
+    next.resize(count);
+    queued.resize(count);
+    nextFade.resize(count);
+    nextClip.resize(count);
+    queuedFade.resize(count);
+    queuedClip.resize(count);
+    speed.resize(count);
+}
+
+c_adv::FsmTransition c_adv::FsmTable::evaluate(int state, uint32_t inputs) const {
+    for (int i = 0; i < m_count; ++i) {
+        FsmTransition t = m_transitions[i];
+        if (t.from != state) continue;
+        if ((inputs & t.require) != t.require) continue;
+        if ((inputs & t.reject) != 0) continue;
+
+        if (t.next == FsmTransition::Keep) t.next = state;
+        if (t.queued == FsmTransition::None) t.queued = m_undefinedState;
+
+        return t;
+    }
+
+    return { state, 0, 0, state, 0.0f, 0.0f, m_undefinedState, 0.0f, 0.0f, 1.0f };
+}
+
+void c_adv::FsmTable::evaluate(
+    const int *states, const uint32_t *inputs, int count, FsmOutputs &outputs) const
+{
+    outputs.resize(count);
+
+    for (int i = 0; i < count; ++i) {
+        const FsmTransition t = evaluate(states[i], inputs[i]);
+
+        outputs.next[i] = t.next;
+        outputs.nextFade[i] = t.nextFade;
+        outputs.nextClip[i] = t.nextClip;
+        outputs.queued[i] = t.queued;
+        outputs.queuedFade[i] = t.queuedFade;
+        outputs.queuedClip[i] = t.queuedClip;
+        outputs.speed[i] = t.speed;
+    }
+}
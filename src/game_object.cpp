@@ -1,10 +1,14 @@
 #include "../include/game_object.h"
 
 #include "../include/world.h"
+#include "../include/realm.h"
 
 #include <float.h>
 
+unsigned int c_adv::GameObject::s_nextObjectId = 0;
+
 c_adv::GameObject::GameObject() {
+    m_objectId = ++s_nextObjectId;
     m_world = nullptr;
     m_deletionFlag = false;
 
@@ -12,11 +16,29 @@ c_adv::GameObject::GameObject() {
 
     m_tags = std::vector<bool>((int)Tag::Count, false);
     m_realmRecordIndex = -1;
+    m_typeId = -1;
+    m_collisionLayer = Layer::Ground;
+
+    m_boundsRadius = 0.0f;
+
+    m_cachedPosition = ysMath::Constants::Zero;
+    m_cachedOrientation = ysMath::Constants::QuatIdentity;
+    m_transformCacheValid = false;
+
+    m_tickLodEnabled = false;
+    m_tickInterval = 1;
+    m_tickPhase = 0;
+    m_tickAccumulator = 0.0f;
+
+    m_wakeRegion = { ysMath::Constants::Zero, ysMath::Constants::Zero };
+    m_sleepEnabled = false;
+    m_sleeping = false;
 
     m_realm = nullptr;
     m_newRealm = nullptr;
     m_changeRealm = false;
     m_lastPortal = nullptr;
+    m_targetRealm = nullptr;
     m_graceMode = false;
     m_real = false;
     m_dead = false;
@@ -46,6 +68,49 @@ void c_adv::GameObject::getAssets(dbasic::AssetManager *am) {
     /* void */
 }
 
+bool c_adv::GameObject::accumulateTick(float dt, unsigned int frame, float *tickDt) {
+    m_tickAccumulator += dt;
+
+    // Phases spread objects in the same tier across frames
+    if ((frame + m_tickPhase) % m_tickInterval != 0) return false;
+
+    *tickDt = m_tickAccumulator;
+    m_tickAccumulator = 0.0f;
+
+    return true;
+}
+
+void c_adv::GameObject::saveState(StateArchive &archive) {
+    archive.writeVector(RigidBody.Transform.GetWorldPosition());
+    archive.writeVector(RigidBody.Transform.GetWorldOrientation());
+    archive.writeVector(RigidBody.GetVelocity());
+    archive.writeVector(RigidBody.GetAngularVelocity());
+
+    unsigned int tags = 0;
+    for (int i = 0; i < (int)Tag::Count; ++i) {
+        if (m_tags[i]) tags |= (0x1 << i);
+    }
+
+    archive.write(tags);
+    archive.write(m_graceMode);
+    archive.write(m_targetRealm);
+}
+
+void c_adv::GameObject::loadState(StateArchive &archive) {
+    RigidBody.Transform.SetPosition(archive.readVector());
+    RigidBody.Transform.SetOrientation(archive.readVector());
+    RigidBody.SetVelocity(archive.readVector());
+    RigidBody.SetAngularVelocity(archive.readVector());
+
+    const unsigned int tags = archive.read<unsigned int>();
+    for (int i = 0; i < (int)Tag::Count; ++i) {
+        m_tags[i] = (tags & (0x1 << i)) != 0;
+    }
+
+    setGraceMode(archive.read<bool>());
+    m_targetRealm = archive.read<Realm *>();
+}
+
 void c_adv::GameObject::onCarry() {
     /* void */
 }
@@ -69,6 +134,32 @@ ysVector c_adv::GameObject::getCollisionVelocity(dphysics::Collision *collision)
         : contactVelocity;
 }
 
+void c_adv::GameObject::setWakeRadius(float radius) {
+    const ysVector r = ysMath::LoadVector(radius, radius, 0.0f, 0.0f);
+    setWakeRegion({ ysMath::Negate(r), r });
+}
+
+c_adv::AABB c_adv::GameObject::getWakeRegionWorld() {
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    return { ysMath::Add(m_wakeRegion.minPoint, position), ysMath::Add(m_wakeRegion.maxPoint, position) };
+}
+
+void c_adv::GameObject::revive() {
+    m_dead = false;
+    m_deletionFlag = false;
+
+    resetRealmChange();
+    m_sleeping = false;
+    RigidBody.SetVelocity(ysMath::Constants::Zero);
+    RigidBody.SetAngularVelocity(ysMath::Constants::Zero);
+}
+
+void c_adv::GameObject::dispatchContact(const ContactEvent &event) {
+    for (const ContactListener &listener : m_contactListeners) {
+        listener(event);
+    }
+}
+
 bool c_adv::GameObject::colliding() {
     int collisionCount = RigidBody.GetCollisionCount();
     for (int i = 0; i < collisionCount; ++i) {
@@ -93,15 +184,32 @@ bool c_adv::GameObject::colliding(GameObject *object) {
 }
 
 void c_adv::GameObject::addVisualBound(const AABB &bound) {
-    m_visualBounds.minPoint = ysMath::ComponentMax(bound.minPoint, m_visualBounds.minPoint);
-    m_visualBounds.maxPoint = ysMath::ComponentMin(bound.maxPoint, m_visualBounds.maxPoint);
+    m_visualBounds.minPoint = ysMath::ComponentMin(bound.minPoint, m_visualBounds.minPoint);
+    m_visualBounds.maxPoint = ysMath::ComponentMax(bound.maxPoint, m_visualBounds.maxPoint);
 }
 
 void c_adv::GameObject::createVisualBounds() {
-    m_visualBounds.maxPoint = ysMath::LoadVector(FLT_MAX, FLT_MAX, 0.0f, 1.0f);
-    m_visualBounds.minPoint = ysMath::LoadVector(-FLT_MAX, -FLT_MAX, 0.0f, 1.0f);
-
     int objects = RigidBody.CollisionGeometry.GetNumObjects();
+
+    if (objects == 0 && m_boundsRadius > 0) {
+        const ysVector position = RigidBody.Transform.GetWorldPosition();
+        const ysVector radius = ysMath::LoadVector(m_boundsRadius, m_boundsRadius, 0.0f, 0.0f);
+
+        m_visualBounds.minPoint = ysMath::Sub(position, radius);
+        m_visualBounds.maxPoint = ysMath::Add(position, radius);
+        return;
+    }
+
+    // Objects without geometry are treated as always visible
+    if (objects == 0) {
+        m_visualBounds.maxPoint = ysMath::LoadVector(FLT_MAX, FLT_MAX, 0.0f, 1.0f);
+        m_visualBounds.minPoint = ysMath::LoadVector(-FLT_MAX, -FLT_MAX, 0.0f, 1.0f);
+        return;
+    }
+
+    m_visualBounds.maxPoint = ysMath::LoadVector(-FLT_MAX, -FLT_MAX, 0.0f, 1.0f);
+    m_visualBounds.minPoint = ysMath::LoadVector(FLT_MAX, FLT_MAX, 0.0f, 1.0f);
+
     for (int i = 0; i < objects; ++i) {
         dphysics::CollisionObject *object = RigidBody.CollisionGeometry.GetCollisionObject(i);
         ysVector minPoint, maxPoint;
@@ -110,6 +218,58 @@ void c_adv::GameObject::createVisualBounds() {
     }
 }
 
+bool c_adv::GameObject::updateTransformCache() {
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    const ysVector orientation = RigidBody.Transform.GetWorldOrientation();
+
+    if (m_transformCacheValid) {
+        const ysVector4 p0 = ysMath::GetVector4(m_cachedPosition), p1 = ysMath::GetVector4(position);
+        const ysVector4 q0 = ysMath::GetVector4(m_cachedOrientation), q1 = ysMath::GetVector4(orientation);
+
+        if (p0.x == p1.x && p0.y == p1.y && p0.z == p1.z &&
+            q0.x == q1.x && q0.y == q1.y && q0.z == q1.z && q0.w == q1.w)
+        {
+            return false;
+        }
+    }
+
+    m_cachedPosition = position;
+    m_cachedOrientation = orientation;
+    m_transformCacheValid = true;
+
+    return true;
+}
+
+void c_adv::GameObject::changeRealm(Realm *newRealm) {
+    if (!m_changeRealm && m_realm != nullptr) {
+        m_realm->queueTransfer(this);
+    }
+
+    m_newRealm = newRealm;
+    m_changeRealm = true;
+}
+
+c_adv::Realm *c_adv::GameObject::resolveTargetRealm() {
+    if (m_targetRealm == nullptr) {
+        m_targetRealm = getTargetRealm();
+    }
+
+    // Portal realms are only generated once something actually enters them
+    if (m_targetRealm == nullptr) {
+        m_targetRealm = generateRealm();
+    }
+
+    return m_targetRealm;
+}
+
+void c_adv::GameObject::sendThroughPortal(GameObject *object) {
+    Realm *targetRealm = resolveTargetRealm();
+    if (targetRealm == nullptr) return;
+
+    object->setLastPortal(this);
+    object->changeRealm(targetRealm);
+}
+
 void c_adv::GameObject::setGraceMode(bool graceMode) {
     m_graceMode = graceMode;
     RigidBody.SetGhost(graceMode);
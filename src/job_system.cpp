@@ -0,0 +1,103 @@
+#include "../include/job_system.h"
+
+c_adv::JobSystem::JobSystem() {
+    m_pending = 0;
+    m_running = false;
+}
+
+c_adv::JobSystem::~JobSystem() {
+    destroy();
+}
+
+void c_adv::JobSystem::initialize(int threadCount) {
+    m_running = true;
+
+    for (int i = 0; i < threadCount; ++i) {
+        m_threads.push_back(std::thread(&JobSystem::worker, this));
+    }
+}
+
+void c_adv::JobSystem::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_running = false;
+    }
+
+    m_jobAvailable.notify_all();
+
+    for (std::thread &thread : m_threads) {
+        thread.join();
+    }
+
+    m_threads.clear();
+}
+
+void c_adv::JobSystem::kick(const Job &job) {
+    if (m_threads.empty()) {
+        job();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_jobs.push(job);
+        ++m_pending;
+    }
+
+    m_jobAvailable.notify_one();
+}
+
+void c_adv::JobSystem::wait() {
+    while (runNext()) {
+        /* void */
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_jobsComplete.wait(lock, [this] { return m_pending == 0; });
+}
+
+void c_adv::JobSystem::worker() {
+    while (true) {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_jobAvailable.wait(lock, [this] { return !m_running || !m_jobs.empty(); });
+
+            if (!m_running && m_jobs.empty()) return;
+
+            job = m_jobs.front(); m_jobs.pop();
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            --m_pending;
+        }
+
+        m_jobsComplete.notify_all();
+    }
+}
+
+bool c_adv::JobSystem::runNext() {
+    Job job;
+
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (m_jobs.empty()) return false;
+
+        job = m_jobs.front(); m_jobs.pop();
+    }
+
+    job();
+
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        --m_pending;
+    }
+
+    m_jobsComplete.notify_all();
+
+    return true;
+}
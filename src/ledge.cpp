@@ -16,16 +16,15 @@ void c_adv::Ledge::initialize() {
     GameObject::initialize();
 
     addTag(Tag::Ledge);
+    addTag(Tag::Static);
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
     RigidBody.SetAlwaysAwake(false);
     RigidBody.SetRequestsInformation(false);
 
-    dphysics::CollisionObject *sensor;
-    RigidBody.CollisionGeometry.NewCircleObject(&sensor);
-    sensor->SetMode(dphysics::CollisionObject::Mode::Sensor);
-    sensor->GetAsCircle()->Radius = 1.0f;
+    // Ledges are found through realm spatial queries rather than sensors
+    setBoundsRadius(1.0f);
 }
 
 void c_adv::Ledge::render() {
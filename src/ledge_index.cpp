@@ -0,0 +1,45 @@
+#include "../include/ledge_index.h"
+
+#include "../include/game_object.h"
+
+#include <algorithm>
+
+c_adv::LedgeIndex::LedgeIndex() {
+    /* void */
+}
+
+c_adv::LedgeIndex::~LedgeIndex() {
+    /* void */
+}
+
+void c_adv::LedgeIndex::clear() {
+    m_entries.clear();
+}
+
+void c_adv::LedgeIndex::add(GameObject *ledge) {
+    const ysVector position = ledge->RigidBody.Transform.GetWorldPosition();
+    m_entries.push_back({ ysMath::GetX(position), ysMath::GetY(position), ledge });
+}
+
+void c_adv::LedgeIndex::build() {
+    std::sort(m_entries.begin(), m_entries.end());
+}
+
+void c_adv::LedgeIndex::query(const ysVector &point, float radius, std::vector<GameObject *> &ledges) const {
+    const float x = ysMath::GetX(point);
+    const float y = ysMath::GetY(point);
+    const float r2 = radius * radius;
+
+    Entry lower;
+    lower.x = x - radius;
+
+    auto it = std::lower_bound(m_entries.begin(), m_entries.end(), lower);
+    for (; it != m_entries.end() && it->x <= x + radius; ++it) {
+        const float dx = it->x - x;
+        const float dy = it->y - y;
+        if (dx * dx + dy * dy > r2) continue;
+        if (it->ledge->getDeletionFlag()) continue;
+
+        ledges.push_back(it->ledge);
+    }
+}
@@ -15,6 +15,18 @@ void c_adv::LightObject::initialize() {
     GameObject::initialize();
 }
 
+void c_adv::LightObject::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_asset);
+}
+
+void c_adv::LightObject::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_asset = archive.read<dbasic::SceneObjectAsset *>();
+}
+
 void c_adv::LightObject::render() {
     const dbasic::SceneObjectAsset::LightInformation &lightInfo = m_asset->GetLightInformation();
     
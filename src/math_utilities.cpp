@@ -1,5 +1,9 @@
 #include "../include/math_utilities.h"
 
+#include "../include/simd.h"
+
+#include <cmath>
+
 ysVector c_adv::vector3d(const ysVector &b) {
     return ysMath::Mask(b, ysMath::Constants::MaskOffW);
 }
@@ -48,7 +52,11 @@ uint64_t c_adv::bitwiseInterleaveWithZeros(uint32_t input) {
 }
 
 uint64_t c_adv::bitwiseInterleave(uint32_t x, uint32_t y) {
+#if defined(CEREAL_ADVENTURE_BMI2_ENABLED)
+    return _pdep_u64(x, 0x5555555555555555) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAA);
+#else
     return bitwiseInterleaveWithZeros(x) | (bitwiseInterleaveWithZeros(y) << 1);
+#endif
 }
 
 uint64_t c_adv::bitwiseReverse(uint64_t input, int bits) {
@@ -62,3 +70,52 @@ uint64_t c_adv::bitwiseReverse(uint64_t input, int bits) {
 
     return result;
 }
+
+uint64_t c_adv::mortonCode2d(float x, float y, float cellSize) {
+    const double Limit = 2147483647.0;
+
+    // Offset so that negative coordinates keep their ordering as unsigned
+    const double qx = min(max(std::floor((double)x / cellSize), -Limit - 1), Limit);
+    const double qy = min(max(std::floor((double)y / cellSize), -Limit - 1), Limit);
+
+    return bitwiseInterleave(
+        (uint32_t)((int64_t)qx + 2147483648LL),
+        (uint32_t)((int64_t)qy + 2147483648LL));
+}
+
+void c_adv::radixSortIndices(const uint64_t *keys, int count, std::vector<int> &order, std::vector<int> &scratch) {
+    order.resize(count);
+    scratch.resize(count);
+
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        int histogram[257] = { 0 };
+        for (int i = 0; i < count; ++i) {
+            ++histogram[((keys[i] >> shift) & 0xFF) + 1];
+        }
+
+        bool trivial = false;
+        for (int b = 1; b <= 256; ++b) {
+            if (histogram[b] == count) {
+                trivial = true;
+                break;
+            }
+        }
+
+        if (trivial) continue;
+
+        for (int b = 1; b <= 256; ++b) {
+            histogram[b] += histogram[b - 1];
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const int index = order[i];
+            scratch[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+        }
+
+        order.swap(scratch);
+    }
+}
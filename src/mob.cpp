@@ -0,0 +1,112 @@
+#include "../include/mob.h"
+
+#include "../include/world.h"
+#include "../include/colors.h"
+
+c_adv::Mob::Mob() {
+    /* void */
+}
+
+c_adv::Mob::~Mob() {
+    /* void */
+}
+
+void c_adv::Mob::initialize() {
+    GameObject::initialize();
+
+    addTag(Tag::Dynamic);
+    setCollisionLayer(Layer::Mob);
+
+    m_attackCooldown.setCooldownPeriod(1.0f);
+    addContactListener([this](const ContactEvent &contact) { onContact(contact); });
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    RigidBody.SetInverseMass(1.0f / 2.0f);
+    RigidBody.SetRequestsInformation(true);
+    RigidBody.SetMaterial(GenericFrictionMaterial);
+
+    dphysics::CollisionObject *bounds;
+    RigidBody.CollisionGeometry.NewBoxObject(&bounds);
+    bounds->SetMode(dphysics::CollisionObject::Mode::Fine);
+    bounds->GetAsBox()->HalfWidth = MobSystem::HalfWidth;
+    bounds->GetAsBox()->HalfHeight = MobSystem::HalfHeight;
+}
+
+void c_adv::Mob::render() {
+    m_world->getShaders().ResetBrdfParameters();
+    m_world->getShaders().SetBaseColor(DebugBlue);
+
+    m_world->getShaders().SetObjectTransform(RigidBody.Transform.GetWorldTransform());
+    m_world->getShaders().ConfigureBox(MobSystem::HalfWidth * 2, MobSystem::HalfHeight * 2);
+    m_world->getEngine().DrawBox(m_world->getShaders().GetRegularFlags(), (int)Layer::Mob);
+    m_world->getShaders().SetColorReplace(false);
+}
+
+void c_adv::Mob::process(float dt) {
+    GameObject::process(dt);
+
+    m_attackCooldown.update(dt);
+
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    const float x = ysMath::GetX(position);
+
+    GameObject *player = m_realm->nearestWithTag(position, MobSystem::DemoteRadius, Tag::Player);
+    if (player == nullptr) {
+        demote();
+        return;
+    }
+
+    const float dx = ysMath::GetX(player->RigidBody.Transform.GetWorldPosition()) - x;
+    if (std::abs(dx) > 0.1f) m_agent.direction = (dx > 0) ? 1.0f : -1.0f;
+
+    // Walk toward the player with the same acceleration limit as the agents
+    const float target = m_agent.direction * m_agent.speed * MobSystem::ChaseSpeedScale;
+    const float vx = ysMath::GetX(RigidBody.GetVelocity());
+    const float a = max(min((target - vx) * 10.0f, MobSystem::Acceleration), -MobSystem::Acceleration);
+
+    const float mass = 1.0f / RigidBody.GetInverseMass();
+    RigidBody.AddForceWorldSpace(ysMath::LoadVector(a * mass, -15.0f * mass, 0.0f), position);
+}
+
+void c_adv::Mob::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_agent);
+}
+
+void c_adv::Mob::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_agent = archive.read<MobAgent>();
+}
+
+void c_adv::Mob::setAgent(const MobAgent &agent) {
+    m_agent = agent;
+
+    RigidBody.Transform.SetPosition(ysMath::LoadVector(agent.x, agent.y, 0.0f));
+    RigidBody.SetVelocity(ysMath::LoadVector(agent.velocityX, 0.0f, 0.0f));
+}
+
+void c_adv::Mob::onContact(const ContactEvent &contact) {
+    if (contact.type != ContactEvent::Type::Begin) return;
+    if (!m_attackCooldown.ready()) return;
+    if (!contact.other->hasTag(Tag::Player)) return;
+
+    m_realm->queueDamage({
+        this,
+        contact.other,
+        ContactDamage,
+        ysMath::LoadVector(m_agent.direction * 5.0f, 5.0f, 0.0f) });
+    m_attackCooldown.trigger();
+}
+
+void c_adv::Mob::demote() {
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+
+    m_agent.x = ysMath::GetX(position);
+    m_agent.y = ysMath::GetY(position);
+    m_agent.velocityX = ysMath::GetX(RigidBody.GetVelocity());
+
+    m_realm->getMobs().emit(m_agent, m_realm);
+    setDeletionFlag();
+}
@@ -0,0 +1,52 @@
+#include "../include/mob_spawner.h"
+
+#include "../include/mob_system.h"
+#include "../include/realm.h"
+
+c_adv::MobSpawner::MobSpawner() {
+    m_count = DefaultCount;
+}
+
+c_adv::MobSpawner::~MobSpawner() {
+    /* void */
+}
+
+void c_adv::MobSpawner::initialize() {
+    GameObject::initialize();
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    RigidBody.SetInverseMass(0.0f);
+}
+
+void c_adv::MobSpawner::process(float dt) {
+    GameObject::process(dt);
+
+    // Spawning waits for the first update so that the rest of the level,
+    // and with it the surface below, has been registered
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    const float x0 = ysMath::GetX(position) - 0.5f * Spacing * (m_count - 1);
+
+    for (int i = 0; i < m_count; ++i) {
+        MobAgent agent;
+        agent.x = x0 + i * Spacing;
+        agent.y = ysMath::GetY(position);
+        agent.homeX = agent.x;
+        agent.direction = (i % 2 == 0) ? 1.0f : -1.0f;
+
+        m_realm->getMobs().emit(agent, m_realm);
+    }
+
+    setDeletionFlag();
+}
+
+void c_adv::MobSpawner::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_count);
+}
+
+void c_adv::MobSpawner::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_count = archive.read<int>();
+}
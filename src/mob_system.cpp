@@ -0,0 +1,372 @@
+#include "../include/mob_system.h"
+
+#include "../include/colors.h"
+#include "../include/mob.h"
+#include "../include/player_legs_fsm.h"
+#include "../include/realm.h"
+#include "../include/world.h"
+
+#include <algorithm>
+#include <float.h>
+
+c_adv::MobSystem::MobSystem() {
+    /* void */
+}
+
+c_adv::MobSystem::~MobSystem() {
+    /* void */
+}
+
+void c_adv::MobSystem::emit(const MobAgent &agent, Realm *realm) {
+    float top, minX, maxX;
+    float y = agent.y;
+    if (findSurface(realm, agent.x, agent.y, &top, &minX, &maxX)) {
+        y = top + HalfHeight;
+    }
+    else {
+        // Without anything to stand on the agent waits to be promoted
+        minX = maxX = agent.x;
+    }
+
+    m_x.push_back(max(min(agent.x, maxX), minX));
+    m_y.push_back(y);
+    m_vx.push_back(agent.velocityX);
+    m_minX.push_back(minX);
+    m_maxX.push_back(maxX);
+    m_homeX.push_back(agent.homeX);
+    m_patrolRange.push_back(agent.patrolRange);
+    m_speed.push_back(agent.speed);
+    m_direction.push_back(agent.direction);
+    m_legsState.push_back((int)PlayerLegsFsm::State::Idle);
+    m_inputs.push_back(0);
+}
+
+void c_adv::MobSystem::clear() {
+    std::vector<float> *floats[] = {
+        &m_x, &m_y, &m_vx, &m_minX, &m_maxX, &m_homeX, &m_patrolRange, &m_speed, &m_direction };
+    for (std::vector<float> *a : floats) {
+        std::vector<float>().swap(*a);
+    }
+
+    std::vector<int>().swap(m_legsState);
+    std::vector<uint32_t>().swap(m_inputs);
+    std::vector<std::pair<uint64_t, int>>().swap(m_cells);
+}
+
+void c_adv::MobSystem::saveState(StateArchive &archive) const {
+    const int N = getCount();
+    archive.write(N);
+
+    const std::vector<float> *floats[] = {
+        &m_x, &m_y, &m_vx, &m_minX, &m_maxX, &m_homeX, &m_patrolRange, &m_speed, &m_direction };
+    for (int i = 0; i < N; ++i) {
+        for (const std::vector<float> *a : floats) archive.write((*a)[i]);
+        archive.write(m_legsState[i]);
+    }
+}
+
+void c_adv::MobSystem::loadState(StateArchive &archive) {
+    const int N = archive.read<int>();
+
+    std::vector<float> *floats[] = {
+        &m_x, &m_y, &m_vx, &m_minX, &m_maxX, &m_homeX, &m_patrolRange, &m_speed, &m_direction };
+    for (std::vector<float> *a : floats) a->resize(N);
+    m_legsState.resize(N);
+    m_inputs.assign(N, 0);
+
+    for (int i = 0; i < N; ++i) {
+        for (std::vector<float> *a : floats) (*a)[i] = archive.read<float>();
+        m_legsState[i] = archive.read<int>();
+    }
+}
+
+void c_adv::MobSystem::update(float dt, Realm *realm) {
+    if (m_x.empty()) return;
+
+    findTargets(realm);
+    buildNeighborIndex();
+
+    JobSystem &jobs = realm->getWorld()->getJobSystem();
+    const int N = getCount();
+
+    // Steering only reads positions, so every block can run before any
+    // of them moves
+    for (int begin = 0; begin < N; begin += JobSize) {
+        const int end = min(begin + JobSize, N);
+        jobs.kick([this, begin, end, dt]() { steer(begin, end, dt); });
+    }
+
+    jobs.wait();
+
+    for (int begin = 0; begin < N; begin += JobSize) {
+        const int end = min(begin + JobSize, N);
+        jobs.kick([this, begin, end, dt]() { integrate(begin, end, dt); });
+    }
+
+    jobs.wait();
+
+    promote(realm);
+
+    PlayerLegsFsm::Table.evaluate(m_legsState.data(), m_inputs.data(), getCount(), m_legsOutputs);
+    m_legsState = m_legsOutputs.next;
+}
+
+void c_adv::MobSystem::render(Realm *realm, const AABB &extents) {
+    World *world = realm->getWorld();
+    Shaders &shaders = world->getShaders();
+
+    const float minX = ysMath::GetX(extents.minPoint) - HalfWidth, minY = ysMath::GetY(extents.minPoint) - HalfHeight;
+    const float maxX = ysMath::GetX(extents.maxPoint) + HalfWidth, maxY = ysMath::GetY(extents.maxPoint) + HalfHeight;
+
+    const int N = getCount();
+    for (int i = 0; i < N; ++i) {
+        if (m_x[i] < minX || m_x[i] > maxX || m_y[i] < minY || m_y[i] > maxY) continue;
+
+        shaders.ResetBrdfParameters();
+        shaders.SetBaseColor(DebugBlue);
+        shaders.SetObjectTransform(ysMath::TranslationTransform(ysMath::LoadVector(m_x[i], m_y[i], 0.0f)));
+        shaders.ConfigureBox(HalfWidth * 2, HalfHeight * 2);
+        world->getEngine().DrawBox(shaders.GetRegularFlags(), (int)GameObject::Layer::Mob);
+    }
+
+    shaders.SetColorReplace(false);
+}
+
+void c_adv::MobSystem::findTargets(Realm *realm) {
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    const int N = getCount();
+    for (int i = 0; i < N; ++i) {
+        minX = min(minX, m_x[i]); maxX = max(maxX, m_x[i]);
+        minY = min(minY, m_y[i]); maxY = max(maxY, m_y[i]);
+    }
+
+    m_targets.clear();
+    realm->overlapBox(
+        {
+            ysMath::LoadVector(minX - ChaseRadius, minY - ChaseRadius, 0.0f, 1.0f),
+            ysMath::LoadVector(maxX + ChaseRadius, maxY + ChaseRadius, 0.0f, 1.0f) },
+        m_targets,
+        GameObject::Tag::Player);
+
+    m_targetX.clear();
+    m_targetY.clear();
+    for (GameObject *target : m_targets) {
+        const ysVector position = target->RigidBody.Transform.GetWorldPosition();
+        m_targetX.push_back(ysMath::GetX(position));
+        m_targetY.push_back(ysMath::GetY(position));
+    }
+}
+
+void c_adv::MobSystem::buildNeighborIndex() {
+    const int N = getCount();
+
+    m_cells.resize(N);
+    for (int i = 0; i < N; ++i) {
+        m_cells[i] = { cellKey(m_x[i], m_y[i]), i };
+    }
+
+    std::sort(m_cells.begin(), m_cells.end());
+}
+
+void c_adv::MobSystem::steer(int begin, int end, float dt) {
+    const int targetCount = (int)m_targetX.size();
+
+    for (int i = begin; i < end; ++i) {
+        const float x = m_x[i], y = m_y[i];
+
+        // Chase the closest player on roughly the same level
+        float closest = ChaseRadius;
+        float chaseDirection = 0.0f;
+        for (int j = 0; j < targetCount; ++j) {
+            const float dx = m_targetX[j] - x;
+            if (std::abs(m_targetY[j] - y) > ChaseHeight) continue;
+            if (std::abs(dx) >= closest) continue;
+
+            closest = std::abs(dx);
+            chaseDirection = (dx > 0) ? 1.0f : -1.0f;
+        }
+
+        float desired;
+        if (chaseDirection != 0.0f) {
+            m_direction[i] = chaseDirection;
+            desired = chaseDirection * m_speed[i] * ChaseSpeedScale;
+        }
+        else {
+            const float patrolMax = min(m_homeX[i] + m_patrolRange[i], m_maxX[i]);
+            const float patrolMin = max(m_homeX[i] - m_patrolRange[i], m_minX[i]);
+            if (x >= patrolMax) m_direction[i] = -1.0f;
+            else if (x <= patrolMin) m_direction[i] = 1.0f;
+
+            desired = m_direction[i] * m_speed[i];
+        }
+
+        // Spread out from neighbors in the same and adjacent cells
+        const int cx = (int)std::floor(x / CellSize);
+        const int cy = (int)std::floor(y / CellSize);
+
+        float separation = 0.0f;
+        int neighbors = 0;
+        for (int ox = -1; ox <= 1 && neighbors < MaxNeighbors; ++ox) {
+            const uint64_t key = cellKey(cx + ox, cy);
+            auto it = std::lower_bound(
+                m_cells.begin(), m_cells.end(), std::pair<uint64_t, int>(key, -1));
+
+            for (; it != m_cells.end() && it->first == key && neighbors < MaxNeighbors; ++it) {
+                const int j = it->second;
+                if (j == i) continue;
+
+                const float d = x - m_x[j];
+                if (std::abs(d) >= SeparationRadius || std::abs(y - m_y[j]) >= SeparationRadius) continue;
+
+                separation += (d >= 0 ? 1.0f : -1.0f) * (SeparationRadius - std::abs(d));
+                ++neighbors;
+            }
+        }
+
+        desired += separation * m_speed[i];
+
+        const float dv = desired - m_vx[i];
+        const float maxDv = Acceleration * dt;
+        m_vx[i] += max(min(dv, maxDv), -maxDv);
+
+        const float speed = std::abs(m_vx[i]);
+        uint32_t inputs = FsmInput::OnSurface | FsmInput::Alive;
+        if (speed > 1.0f) inputs |= FsmInput::Moving;
+        if (speed < 1.0f) inputs |= FsmInput::Slow;
+        m_inputs[i] = inputs;
+    }
+}
+
+void c_adv::MobSystem::integrate(int begin, int end, float dt) {
+    for (int i = begin; i < end; ++i) {
+        const float x = m_x[i] + m_vx[i] * dt;
+        m_x[i] = max(min(x, m_maxX[i]), m_minX[i]);
+        if (m_x[i] != x) m_vx[i] = 0.0f;
+    }
+}
+
+void c_adv::MobSystem::promote(Realm *realm) {
+    const int targetCount = (int)m_targetX.size();
+    if (targetCount == 0) return;
+
+    for (int i = 0; i < getCount(); ++i) {
+        bool inRange = false;
+        for (int j = 0; j < targetCount && !inRange; ++j) {
+            const float dx = m_targetX[j] - m_x[i];
+            const float dy = m_targetY[j] - m_y[i];
+            inRange = dx * dx + dy * dy < PromoteRadius * PromoteRadius;
+        }
+
+        if (!inRange) continue;
+
+        MobAgent agent;
+        agent.x = m_x[i];
+        agent.y = m_y[i];
+        agent.velocityX = m_vx[i];
+        agent.homeX = m_homeX[i];
+        agent.patrolRange = m_patrolRange[i];
+        agent.speed = m_speed[i];
+        agent.direction = m_direction[i];
+
+        Mob *mob = realm->spawn<Mob>();
+        mob->setAgent(agent);
+
+        removeSwap(i--);
+    }
+}
+
+void c_adv::MobSystem::removeSwap(int index) {
+    std::vector<float> *floats[] = {
+        &m_x, &m_y, &m_vx, &m_minX, &m_maxX, &m_homeX, &m_patrolRange, &m_speed, &m_direction };
+    for (std::vector<float> *a : floats) {
+        (*a)[index] = a->back(); a->pop_back();
+    }
+
+    m_legsState[index] = m_legsState.back(); m_legsState.pop_back();
+    m_inputs[index] = m_inputs.back(); m_inputs.pop_back();
+}
+
+bool c_adv::MobSystem::findSurface(Realm *realm, float x, float y, float *top, float *minX, float *maxX) {
+    const float feet = y - HalfHeight;
+
+    m_obstacles.clear();
+    realm->queryStaticObjects(
+        {
+            ysMath::LoadVector(x, feet - SurfaceProbeDepth, 0.0f, 1.0f),
+            ysMath::LoadVector(x, feet + SurfaceTolerance, 0.0f, 1.0f) },
+        m_obstacles);
+
+    bool found = false;
+    for (GameObject *obstacle : m_obstacles) {
+        if (obstacle->RigidBody.CollisionGeometry.GetNumObjects() == 0) continue;
+
+        const AABB &bounds = obstacle->getVisualBounds();
+        const float surface = ysMath::GetY(bounds.maxPoint);
+        if (surface > feet + SurfaceTolerance) continue;
+        if (found && surface <= *top) continue;
+
+        found = true;
+        *top = surface;
+        *minX = ysMath::GetX(bounds.minPoint);
+        *maxX = ysMath::GetX(bounds.maxPoint);
+    }
+
+    if (!found) return false;
+
+    // Counters and shelves are often built from several flush segments
+    for (int segment = 0; segment < MaxSurfaceSegments; ++segment) {
+        m_obstacles.clear();
+        realm->queryStaticObjects(
+            {
+                ysMath::LoadVector(*minX - SurfaceTolerance, *top - SurfaceTolerance, 0.0f, 1.0f),
+                ysMath::LoadVector(*maxX + SurfaceTolerance, *top + SurfaceTolerance, 0.0f, 1.0f) },
+            m_obstacles);
+
+        bool extended = false;
+        for (GameObject *obstacle : m_obstacles) {
+            if (obstacle->RigidBody.CollisionGeometry.GetNumObjects() == 0) continue;
+
+            const AABB &bounds = obstacle->getVisualBounds();
+            if (std::abs(ysMath::GetY(bounds.maxPoint) - *top) > SurfaceTolerance) continue;
+
+            const float segmentMinX = ysMath::GetX(bounds.minPoint);
+            const float segmentMaxX = ysMath::GetX(bounds.maxPoint);
+            if (segmentMinX < *minX) { *minX = segmentMinX; extended = true; }
+            if (segmentMaxX > *maxX) { *maxX = segmentMaxX; extended = true; }
+        }
+
+        if (!extended) break;
+    }
+
+    // Walls standing on the surface cut it short
+    m_obstacles.clear();
+    realm->queryStaticObjects(
+        {
+            ysMath::LoadVector(*minX, *top + SurfaceTolerance, 0.0f, 1.0f),
+            ysMath::LoadVector(*maxX, *top + 2 * HalfHeight, 0.0f, 1.0f) },
+        m_obstacles);
+
+    for (GameObject *obstacle : m_obstacles) {
+        if (obstacle->RigidBody.CollisionGeometry.GetNumObjects() == 0) continue;
+
+        const AABB &bounds = obstacle->getVisualBounds();
+        const float wallMinX = ysMath::GetX(bounds.minPoint);
+        const float wallMaxX = ysMath::GetX(bounds.maxPoint);
+        if (wallMaxX <= x) *minX = max(*minX, wallMaxX);
+        else if (wallMinX >= x) *maxX = min(*maxX, wallMinX);
+    }
+
+    *minX += HalfWidth;
+    *maxX -= HalfWidth;
+    if (*minX > *maxX) *minX = *maxX = 0.5f * (*minX + *maxX);
+
+    return true;
+}
+
+uint64_t c_adv::MobSystem::cellKey(float x, float y) const {
+    return cellKey((int)std::floor(x / CellSize), (int)std::floor(y / CellSize));
+}
+
+uint64_t c_adv::MobSystem::cellKey(int x, int y) {
+    return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+}
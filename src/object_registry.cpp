@@ -0,0 +1,19 @@
+#include "../include/object_registry.h"
+
+#include "../include/game_object.h"
+
+c_adv::GameObject *c_adv::ObjectRegistry::create(int typeId) {
+    return constructors()[typeId]();
+}
+
+int c_adv::ObjectRegistry::registerType(Constructor constructor) {
+    std::vector<Constructor> &list = constructors();
+    list.push_back(constructor);
+
+    return (int)list.size() - 1;
+}
+
+std::vector<c_adv::ObjectRegistry::Constructor> &c_adv::ObjectRegistry::constructors() {
+    static std::vector<Constructor> list;
+    return list;
+}
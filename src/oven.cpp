@@ -6,7 +6,7 @@
 dbasic::ModelAsset *c_adv::Oven::m_ovenAsset = nullptr;
 
 c_adv::Oven::Oven() {
-    /* void */
+    m_hot = false;
 }
 
 c_adv::Oven::~Oven() {
@@ -29,8 +29,7 @@ void c_adv::Oven::initialize() {
     bounds->GetAsBox()->Orientation = ysMath::Constants::QuatIdentity;
     bounds->GetAsBox()->Position = ysMath::Constants::Zero;
 
-    m_clock.setLowTime(2.0f);
-    m_clock.setHighTime(2.0f);
+    m_realm->getTimers().schedule(this, HeatPeriod, [this]() { toggleHeat(); });
 }
 
 void c_adv::Oven::render() {
@@ -50,14 +49,13 @@ void c_adv::Oven::render() {
     m_world->getEngine().DrawModel(m_world->getShaders().GetRegularFlags(), m_ovenAsset);
 }
 
-void c_adv::Oven::process(float dt) {
-    GameObject::process(dt);
-
-    m_clock.update(dt);
+bool c_adv::Oven::isHot() {
+    return m_hot;
 }
 
-bool c_adv::Oven::isHot() {
-    return m_clock.getState();
+void c_adv::Oven::toggleHeat() {
+    m_hot = !m_hot;
+    m_realm->getTimers().schedule(this, HeatPeriod, [this]() { toggleHeat(); });
 }
 
 bool c_adv::Oven::isDangerous(const ysVector &p_world) {
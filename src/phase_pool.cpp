@@ -0,0 +1,68 @@
+#include "../include/phase_pool.h"
+
+#include <cmath>
+
+c_adv::PhasePool::PhasePool(bool generateWaves) {
+    m_generateWaves = generateWaves;
+}
+
+c_adv::PhasePool::~PhasePool() {
+    /* void */
+}
+
+int c_adv::PhasePool::allocate() {
+    if (!m_freeList.empty()) {
+        const int handle = m_freeList.back(); m_freeList.pop_back();
+        return handle;
+    }
+
+    m_phase.push_back(0.0f);
+    m_rate.push_back(0.0f);
+    m_period.push_back(0.0f);
+    m_value.push_back(0.0f);
+
+    return (int)m_phase.size() - 1;
+}
+
+void c_adv::PhasePool::release(int handle) {
+    m_phase[handle] = 0.0f;
+    m_rate[handle] = 0.0f;
+    m_period[handle] = 0.0f;
+    m_value[handle] = 0.0f;
+
+    m_freeList.push_back(handle);
+}
+
+void c_adv::PhasePool::setPeriod(int handle, float period) {
+    m_period[handle] = period;
+    m_rate[handle] = (period > 0) ? 1 / period : 0.0f;
+}
+
+void c_adv::PhasePool::update(float dt) {
+    const int N = (int)m_phase.size();
+    float *phase = m_phase.data();
+    const float *rate = m_rate.data();
+
+    // Straight-line loops so that the compiler can vectorize them
+    for (int i = 0; i < N; ++i) {
+        const float t = phase[i] + dt * rate[i];
+        phase[i] = t - std::floor(t);
+    }
+
+    if (!m_generateWaves) return;
+
+    float *value = m_value.data();
+    for (int i = 0; i < N; ++i) {
+        value[i] = sinTurns(phase[i]);
+    }
+}
+
+float c_adv::PhasePool::sinTurns(float t) {
+    // Map [0, 1) to [-1, 1) where -1 corresponds to -pi
+    const float x = 2 * t - 1;
+
+    // Parabolic fit with one refinement step, max error is about 0.001.
+    // The sign flip accounts for sin(x + pi) = -sin(x).
+    const float y = 4 * x - 4 * x * std::abs(x);
+    return -(0.225f * (y * std::abs(y) - y) + y);
+}
@@ -49,7 +49,7 @@ c_adv::Player::Player() {
     m_gripLink = nullptr;
     m_ledge = nullptr;
 
-    m_health = 20.0f;
+    m_health = MaxHealth;
     m_ledgeGraspDistance = 0.4f;
     m_graspReady = false;
     m_launching = false;
@@ -86,8 +86,7 @@ void c_adv::Player::initialize() {
     m_fireDamageComponent.initialize(this);
     m_walkComponent.initialize(this);
     m_projectileDamageComponent.initialize(this);
-    m_armsFsm.initialize(this);
-    m_legsFsm.initialize(this);
+    addContactListener([this](const ContactEvent &contact) { processImpactDamage(contact); });
     m_deathComponent.initialize(this);
 
     RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
@@ -95,10 +94,12 @@ void c_adv::Player::initialize() {
     RigidBody.SetAlwaysAwake(true);
     RigidBody.SetRequestsInformation(true);
     RigidBody.SetMaterial(PlayerFrictionMaterial);
+    setCollisionLayer(Layer::Player);
 
     m_springConnector.setDampingTensor(ysMath::LoadVector(0.5f, 0.5f, 0.0f));
     m_springConnector.setStiffnessTensor(ysMath::LoadVector(500.0f, 500.0f, 0.0f));
     m_springConnector.setPosition(RigidBody.Transform.GetWorldPosition());
+    m_springConnector.setMode(SpringConnector::Mode::CriticallyDamped);
 
     RigidBody.CollisionGeometry.NewBoxObject(&m_bodyCollider);
     m_bodyCollider->SetMode(dphysics::CollisionObject::Mode::Fine);
@@ -111,11 +112,6 @@ void c_adv::Player::initialize() {
     m_walkCollider->GetAsBox()->HalfHeight = 0.3f;
     m_walkCollider->GetAsBox()->HalfWidth = 0.3f;
 
-    dphysics::CollisionObject *bounds;
-    RigidBody.CollisionGeometry.NewCircleObject(&bounds);
-    bounds->SetMode(dphysics::CollisionObject::Mode::Sensor);
-    bounds->GetAsCircle()->Radius = 4.0f;
-
     m_renderSkeleton = m_world->getAssetManager().BuildRenderSkeleton(
         &m_renderTransform, CharacterRoot);
 
@@ -150,7 +146,6 @@ void c_adv::Player::process(float dt) {
 
     m_fireDamageComponent.process(dt);
     m_walkComponent.process(dt);
-    m_projectileDamageComponent.process(dt);
     m_deathComponent.process(dt);
 
     if (m_world->getEngine().ProcessKeyDown(ysKey::Code::T)) {
@@ -165,12 +160,10 @@ void c_adv::Player::process(float dt) {
     }
 
     m_springConnector.setTarget(RigidBody.Transform.GetWorldPosition());
-    m_springConnector.update(dt);
 
     m_renderTransform.SetPosition(RigidBody.Transform.GetWorldPosition());
     m_renderTransform.SetOrientation(RigidBody.Transform.GetWorldOrientation());
 
-    processImpactDamage();
     updateMotion(dt);
     updateAnimation(dt);
 
@@ -227,6 +220,13 @@ void c_adv::Player::render() {
             m_realm->getAliveObjectCount() << "/" <<
             m_realm->getDeadObjectCount() << "/" <<
             m_realm->getVisibleObjectCount() << "          \n";
+        const PhysicsStats &physics = m_realm->getPhysicsStats();
+        msg << "PHYS S/B/P/C/I: " <<
+            physics.substeps << "/" <<
+            physics.bodies << "/" <<
+            physics.pairs << "/" <<
+            physics.contacts << "/" <<
+            physics.islands << "          \n";
         msg << "Health: " << m_health << "              \n";
         msg << "Last Miss: " << m_lastMissReason << "              \n";
         msg << "Status: ";
@@ -329,8 +329,6 @@ bool c_adv::Player::attemptGrip() {
 }
 
 c_adv::GameObject *c_adv::Player::findGrip(bool &ready) {
-    const int collisionCount = RigidBody.GetCollisionCount();
-
     float closestLedgeDistance = FLT_MAX;
     GameObject *closestLedge = nullptr;
 
@@ -340,23 +338,20 @@ c_adv::GameObject *c_adv::Player::findGrip(bool &ready) {
 
     ready = false;
 
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *col = RigidBody.GetCollision(i);
-        if (!getCollidingObject(col)->hasTag(Tag::Ledge)) continue;
+    m_nearbyObjects.clear();
+    m_realm->queryLedges(gripLocation, m_ledgeGraspDistance, m_nearbyObjects);
 
-        GameObject *ledge = getCollidingObject(col);
-        if (col->m_sensor && !col->IsGhost()) {
-            ysVector ledgePosition = ledge->RigidBody.Transform.GetWorldPosition();
-            const float ly = ysMath::GetY(ledgePosition);
-            const float lx = ysMath::GetX(ledgePosition);
-
-            if (ly < gy) {
-                const float d = distance(gripLocation, ledgePosition);
-                if (d < closestLedgeDistance && d < m_ledgeGraspDistance && d > m_ledgeGraspDistance * 0.2f) {
-                    ready = (std::abs(gx - lx) < 0.1f);
-                    closestLedge = ledge;
-                    closestLedgeDistance = d;
-                }
+    for (GameObject *ledge : m_nearbyObjects) {
+        ysVector ledgePosition = ledge->RigidBody.Transform.GetWorldPosition();
+        const float ly = ysMath::GetY(ledgePosition);
+        const float lx = ysMath::GetX(ledgePosition);
+
+        if (ly < gy) {
+            const float d = distance(gripLocation, ledgePosition);
+            if (d < closestLedgeDistance && d < m_ledgeGraspDistance && d > m_ledgeGraspDistance * 0.2f) {
+                ready = (std::abs(gx - lx) < 0.1f);
+                closestLedge = ledge;
+                closestLedgeDistance = d;
             }
         }
     }
@@ -386,42 +381,91 @@ ysVector c_adv::Player::getGripLocationWorld() {
     return RigidBody.Transform.LocalToWorldSpace(getGripLocationLocal());
 }
 
-void c_adv::Player::processImpactDamage() {
-    const float VerticalThreshold = ysMath::Constants::SQRT_2 / 2;
+void c_adv::Player::revive() {
+    GameObject::revive();
 
-    const int collisionCount = RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *col = RigidBody.GetCollision(i);
-        // TODO: check if hanging or not
+    releaseGrip();
+    m_health = MaxHealth;
+    m_launching = false;
 
-        if (!col->m_sensor && !col->IsGhost()) {
-            if (std::abs(ysMath::GetY(col->m_normal)) < VerticalThreshold) continue;
+    m_movementCooldown.reset();
+    m_gripCooldown.reset();
+    m_deathComponent.reset();
 
-            GameObject *object = getCollidingObject(col);
-            dphysics::RigidBody &other = object->RigidBody;
+    resetAnimation();
+}
 
-            const ysVector closingVelocity = col->GetContactVelocityWorld();
-            const float mag = (&RigidBody == col->m_body1)
-                ? ysMath::GetY(closingVelocity)
-                : -ysMath::GetY(closingVelocity);
+void c_adv::Player::saveRuntimeState(StateArchive &archive) {
+    archive.write(m_health);
+    archive.write(m_nextDirection);
 
-            if (mag < -m_fallDamageThreshold && other.GetInverseMass() < RigidBody.GetInverseMass()) {
-                takeDamage(abs(mag) - m_fallDamageThreshold);
-                m_movementCooldown.trigger();
+    m_movementCooldown.saveState(archive);
+    m_gripCooldown.saveState(archive);
+    m_deathComponent.saveState(archive);
+}
 
-                playShakeSound();
-            }
+void c_adv::Player::loadRuntimeState(StateArchive &archive) {
+    releaseGrip();
 
-            if (mag < -m_landingVelocityThreshold) {
-                playShakeSound();
-                if (!object->hasTag(GameObject::Tag::Ledge)) {
-                    onLand();
-                }
-            }
+    m_health = archive.read<float>();
+    m_nextDirection = archive.read<Direction>();
+
+    m_movementCooldown.loadState(archive);
+    m_gripCooldown.loadState(archive);
+    m_deathComponent.loadState(archive);
+
+    // The animation FSMs follow from the restored inputs on the next tick,
+    // except that nothing leads out of the dying state
+    if (isAlive() && m_legsFsm.getState() == PlayerLegsFsm::State::Dying) {
+        resetAnimation();
+    }
+}
+
+void c_adv::Player::resetAnimation() {
+    ysAnimationChannel::ActionSettings settings;
+    settings.FadeIn = 20.0f;
+    settings.Speed = 1.0f;
+
+    m_legsChannel->ClearQueue();
+    m_legsChannel->AddSegment(&m_animLegsIdle, settings);
+    m_legsFsm.updateState(PlayerLegsFsm::State::Idle);
+
+    m_armsChannel->ClearQueue();
+    m_armsChannel->AddSegment(&m_animArmsIdle, settings);
+    m_armsFsm.updateState(PlayerArmsFsm::State::Idle);
+}
+
+void c_adv::Player::processImpactDamage(const ContactEvent &contact) {
+    const float VerticalThreshold = ysMath::Constants::SQRT_2 / 2;
+
+    // TODO: check if hanging or not
+    if (std::abs(ysMath::GetY(contact.normal)) < VerticalThreshold) return;
+
+    GameObject *object = contact.other;
+    dphysics::RigidBody &other = object->RigidBody;
+
+    const float mag = ysMath::GetY(contact.closingVelocity);
+
+    if (mag < -m_fallDamageThreshold && other.GetInverseMass() < RigidBody.GetInverseMass()) {
+        m_realm->queueDamage({ object, this, abs(mag) - m_fallDamageThreshold, ysMath::Constants::Zero });
+        m_movementCooldown.trigger();
+
+        playShakeSound();
+    }
+
+    if (mag < -m_landingVelocityThreshold) {
+        playShakeSound();
+        if (!object->hasTag(GameObject::Tag::Ledge)) {
+            onLand();
         }
     }
 }
 
+void c_adv::Player::onDamage(const DamageEvent &damage) {
+    RigidBody.AddImpulseWorldSpace(damage.impulse, RigidBody.Transform.GetWorldPosition());
+    takeDamage(damage.amount);
+}
+
 void c_adv::Player::updateCollisionBounds() {
     ysTransform *prevParent = m_renderSkeleton->GetRoot()->Transform.GetParent();
     m_renderSkeleton->GetRoot()->Transform.SetParent(&RigidBody.Transform);
@@ -459,7 +503,10 @@ void c_adv::Player::takeDamage(float damage) {
     m_world->getUi().triggerDamage(min(20.0f, damage) / 20.0f);
 
     releaseGrip();
+
+    const bool wasAlive = isAlive();
     m_health -= damage;
+    if (wasAlive && !isAlive()) m_deathComponent.onDeath();
 
     dbasic::AudioAsset *const DamageEffects[] = {
         AudioDamage01,
@@ -467,7 +514,7 @@ void c_adv::Player::takeDamage(float damage) {
     };
 
     const int randomIndex = ysMath::UniformRandomInt(2);
-    m_world->getEngine().PlayAudio(DamageEffects[randomIndex]);
+    m_world->getAudio().play(DamageEffects[randomIndex], AudioGroup::Damage, 2);
 }
 
 ysAnimationActionBinding *c_adv::Player::getArmsAction(PlayerArmsFsm::State state) {
@@ -577,17 +624,39 @@ void c_adv::Player::updateMotion(float dt) {
 }
 
 void c_adv::Player::updateAnimation(float dt) {
-    legsAnimationFsm();
+    const uint32_t inputs = getFsmInputs();
+
+    legsAnimationFsm(inputs);
     rotationAnimationFsm();
-    armsAnimationFsm();
+    armsAnimationFsm(inputs);
 
     m_renderSkeleton->UpdateAnimation(dt * 60.0f);
 }
 
-void c_adv::Player::legsAnimationFsm() {
+uint32_t c_adv::Player::getFsmInputs() {
+    const ysVector velocity = RigidBody.GetVelocity();
+    const float horizontalVelocity = std::abs(ysMath::GetX(velocity));
+    const float fallSpeed = max(-ysMath::GetY(velocity), 0.0f);
+
+    uint32_t inputs = 0;
+    if (m_walkComponent.isOnSurface()) inputs |= FsmInput::OnSurface;
+    if (isHurt()) inputs |= FsmInput::Hurt;
+    if (isHanging()) inputs |= FsmInput::Hanging;
+    if (isGraspReady()) inputs |= FsmInput::GraspReady;
+    if (isLaunching()) inputs |= FsmInput::Launching;
+    if (isCurrentArmActionComplete()) inputs |= FsmInput::ActionComplete;
+    if (isAlive()) inputs |= FsmInput::Alive;
+    if (horizontalVelocity > 1.0f) inputs |= FsmInput::Moving;
+    if (horizontalVelocity < 1.0f) inputs |= FsmInput::Slow;
+    if (fallSpeed > 9.0f) inputs |= FsmInput::FastFalling;
+
+    return inputs;
+}
+
+void c_adv::Player::legsAnimationFsm(uint32_t inputs) {
     PlayerLegsFsm::State current = m_legsFsm.getState();
     PlayerLegsFsm::FsmResults next;
-    m_legsFsm.nextState(next);
+    m_legsFsm.nextState(inputs, next);
 
     m_legsChannel->ClearQueue();
 
@@ -637,10 +706,10 @@ void c_adv::Player::rotationAnimationFsm() {
     }
 }
 
-void c_adv::Player::armsAnimationFsm() {
+void c_adv::Player::armsAnimationFsm(uint32_t inputs) {
     PlayerArmsFsm::State current = m_armsFsm.getState();
     PlayerArmsFsm::FsmResults next;
-    m_armsFsm.nextState(next);
+    m_armsFsm.nextState(inputs, next);
 
     m_armsChannel->ClearQueue();
 
@@ -707,7 +776,7 @@ void c_adv::Player::onJump() {
         };
 
         const int randomIndex = ysMath::UniformRandomInt(sizeof(JumpEffects) / sizeof(dbasic::AudioAsset *));
-        m_world->getEngine().PlayAudio(JumpEffects[randomIndex]);
+        m_world->getAudio().play(JumpEffects[randomIndex], AudioGroup::Player, 1);
     }
 }
 
@@ -729,7 +798,7 @@ void c_adv::Player::playFootstepSound() {
         const int randomIndex = ysMath::UniformRandomInt(4);
         dbasic::AudioAsset *randomFootstep = FootstepEffects[randomIndex];
 
-        m_world->getEngine().PlayAudio(randomFootstep);
+        m_world->getAudio().play(randomFootstep, AudioGroup::Footsteps, 0);
     }
 }
 
@@ -746,7 +815,7 @@ void c_adv::Player::playShakeSound() {
         };
 
         const int randomIndex = ysMath::UniformRandomInt(3);
-        m_world->getEngine().PlayAudio(ShakeEffect[randomIndex]);
+        m_world->getAudio().play(ShakeEffect[randomIndex], AudioGroup::Player, 0);
     }
 }
 
@@ -1,9 +1,66 @@
 #include "../include/player_arms_fsm.h"
 
-#include "../include/player.h"
+namespace c_adv {
+
+    static constexpr int S(PlayerArmsFsm::State state) { return (int)state; }
+
+    static constexpr int Keep = FsmTransition::Keep;
+    static constexpr int None = FsmTransition::None;
+
+    static constexpr uint32_t OnSurface = FsmInput::OnSurface;
+    static constexpr uint32_t Hurt = FsmInput::Hurt;
+    static constexpr uint32_t Hanging = FsmInput::Hanging;
+    static constexpr uint32_t GraspReady = FsmInput::GraspReady;
+    static constexpr uint32_t Launching = FsmInput::Launching;
+    static constexpr uint32_t ActionComplete = FsmInput::ActionComplete;
+    static constexpr uint32_t Alive = FsmInput::Alive;
+    static constexpr uint32_t Moving = FsmInput::Moving;
+
+    typedef PlayerArmsFsm::State State;
+
+    static constexpr FsmTransition ArmsTransitions[] = {
+        // from, require, reject, next, fade, clip, queued, fade, clip, speed
+        { S(State::Idle),         OnSurface,            Alive,         S(State::Dying),            20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Idle),         OnSurface | Hurt,     0,             S(State::ImpactDamage),     20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Idle),         OnSurface | Moving,   0,             S(State::Running),          20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Idle),         OnSurface,            0,             Keep,                        0.0f, 0.0f,  S(State::Idle),            0.0f,  0.0f,  1.0f },
+        { S(State::Idle),         Hanging,              0,             S(State::Hanging),           2.0f, 30.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Idle),         GraspReady,           0,             S(State::Hanging),           5.0f, 10.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Idle),         0,                    0,             S(State::Idle),             20.0f, 0.0f,  S(State::Idle),            0.0f,  0.0f,  1.0f },
+
+        { S(State::Running),      OnSurface,            Alive,         S(State::Dying),            20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Running),      OnSurface | Hurt,     0,             S(State::ImpactDamage),     20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Running),      OnSurface,            Moving,        S(State::Idle),             20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Running),      OnSurface,            0,             S(State::Running),           0.0f, 0.0f,  S(State::Running),         0.0f,  0.0f,  1.0f },
+        { S(State::Running),      Hanging,              0,             S(State::Hanging),           2.0f, 30.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Running),      GraspReady,           0,             S(State::Hanging),          10.0f, 10.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Running),      0,                    0,             S(State::Idle),             20.0f, 0.0f,  S(State::Idle),            0.0f,  0.0f,  1.0f },
+
+        { S(State::Hanging),      Hanging,              Launching,     S(State::Hanging),           2.0f, 30.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Hanging),      Hanging,              0,             S(State::Launching),         1.0f, 0.0f,  None,                      0.0f,  0.0f,  1.5f },
+        { S(State::Hanging),      GraspReady,           0,             S(State::Hanging),          10.0f, 10.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::Hanging),      OnSurface | Hurt,     0,             S(State::ImpactDamage),     20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Hanging),      OnSurface,            Moving,        S(State::Idle),             20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Hanging),      OnSurface,            0,             S(State::Running),          20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::Hanging),      0,                    0,             S(State::Idle),             40.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+
+        { S(State::ImpactDamage), Hanging,              0,             S(State::Hanging),           2.0f, 30.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::ImpactDamage), GraspReady,           0,             S(State::Hanging),          10.0f, 10.0f, S(State::Hanging),        20.0f, 30.0f, 1.0f },
+        { S(State::ImpactDamage), OnSurface,            Hurt,          S(State::Idle),             20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::ImpactDamage), OnSurface,            0,             Keep,                        0.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+        { S(State::ImpactDamage), 0,                    0,             S(State::Idle),             40.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f },
+
+        { S(State::Launching),    ActionComplete,       0,             S(State::Idle),             20.0f, 0.0f,  None,                      0.0f,  0.0f,  1.0f }
+    };
+
+} /* namespace c_adv */
+
+const c_adv::FsmTable c_adv::PlayerArmsFsm::Table(
+    ArmsTransitions,
+    (int)(sizeof(ArmsTransitions) / sizeof(ArmsTransitions[0])),
+    (int)State::Undefined);
 
 c_adv::PlayerArmsFsm::PlayerArmsFsm() {
-    m_player = nullptr;
     m_currentState = State::Idle;
 }
 
@@ -11,215 +68,14 @@ c_adv::PlayerArmsFsm::~PlayerArmsFsm() {
     /* void */
 }
 
-void c_adv::PlayerArmsFsm::initialize(Player *player) {
-    m_player = player;
-}
+void c_adv::PlayerArmsFsm::nextState(uint32_t inputs, FsmResults &result) {
+    const FsmTransition t = Table.evaluate((int)m_currentState, inputs);
 
-void c_adv::PlayerArmsFsm::nextState(FsmResults &result) {
-    ysVector velocity = m_player->RigidBody.GetVelocity();
-
-    // FSM inputs
-    State current = m_currentState;
-    const bool onSurface = m_player->m_walkComponent.isOnSurface();
-    const bool isHurt = m_player->isHurt();
-    const bool isHanging = m_player->isHanging();
-    const bool isGraspReady = m_player->isGraspReady();
-    const bool isLaunching = m_player->isLaunching();
-    const bool isActionComplete = m_player->isCurrentArmActionComplete();
-    const float horizontalVelocity = ysMath::GetX(velocity);
-    const bool isMoving = std::abs(horizontalVelocity) > 1.0f;
-    const bool isAlive = m_player->isAlive();
-
-    // FSM Output
-    State next = current;
-    State queued = State::Undefined;
-
-    float nextFade = 0.0f;
-    float nextClip = 0.0f;
-    float queuedFade = 0.0f;
-    float queuedClip = 0.0f;
-    float speed = 1.0f;
-
-    // FSM
-    if (current == State::Idle) {
-        if (onSurface) {
-            if (!isAlive) {
-                next = State::Dying;
-                nextFade = 20.0f;
-            }
-            else if (isHurt) {
-                next = State::ImpactDamage;
-                nextFade = 20.0f;
-            }
-            else if (isMoving) {
-                next = State::Running;
-                nextFade = 20.0f;
-            }
-            else {
-                queued = State::Idle;
-            }
-        }
-        else if (isHanging) {
-            next = State::Hanging;
-            nextFade = 2.0f;
-            nextClip = 30.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else if (isGraspReady) {
-            next = State::Hanging;
-            nextFade = 5.0f;
-            nextClip = 10.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else {
-            next = State::Idle;
-            nextFade = 20.0f;
-
-            queued = State::Idle;
-            queuedFade = 0.0f;
-        }
-    }
-    else if (current == State::Running) {
-        if (onSurface) {
-            if (!isAlive) {
-                next = State::Dying;
-                nextFade = 20.0f;
-            }
-            else if (isHurt) {
-                next = State::ImpactDamage;
-                nextFade = 20.0f;
-            }
-            else {
-                if (!isMoving) {
-                    next = State::Idle;
-                    nextFade = 20.0f;
-                }
-                else {
-                    next = State::Running;
-                    queued = State::Running;
-                    queuedFade = 0.0f;
-                }
-            }
-        }
-        else if (isHanging) {
-            next = State::Hanging;
-            nextFade = 2.0f;
-            nextClip = 30.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else if (isGraspReady) {
-            next = State::Hanging;
-            nextFade = 10.0f;
-            nextClip = 10.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else {
-            next = State::Idle;
-            nextFade = 20.0f;
-
-            queued = State::Idle;
-        }
-    }
-    else if (current == State::Hanging) {
-        if (isHanging) {
-            if (!isLaunching) {
-                next = State::Hanging;
-                nextFade = 2.0f;
-                nextClip = 30.0f;
-
-                queued = State::Hanging;
-                queuedFade = 20.0f;
-                queuedClip = 30.0f;
-            }
-            else {
-                next = State::Launching;
-                nextFade = 1.0f;
-                speed = 1.5f;
-            }
-        }
-        else if (isGraspReady) {
-            next = State::Hanging;
-            nextFade = 10.0f;
-            nextClip = 10.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else if (onSurface) {
-            if (isHurt) {
-                next = State::ImpactDamage;
-                nextFade = 20.0f;
-            }
-            else if (!isMoving) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-            else {
-                next = State::Running;
-                nextFade = 20.0f;
-            }
-        }
-        else {
-            next = State::Idle;
-            nextFade = 40.0f;
-        }
-    }
-    else if (current == State::ImpactDamage) {
-        if (isHanging) {
-            next = State::Hanging;
-            nextFade = 2.0f;
-            nextClip = 30.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else if (isGraspReady) {
-            next = State::Hanging;
-            nextFade = 10.0f;
-            nextClip = 10.0f;
-
-            queued = State::Hanging;
-            queuedFade = 20.0f;
-            queuedClip = 30.0f;
-        }
-        else if (onSurface) {
-            if (!isHurt) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-        }
-        else {
-            next = State::Idle;
-            nextFade = 40.0f;
-        }
-    }
-    else if (current == State::Launching) {
-        if (isActionComplete) {
-            next = State::Idle;
-            nextFade = 20.0f;
-        }
-    }
-
-    // Output
-    result.next = next;
-    result.nextClip = nextClip;
-    result.nextFade = nextFade;
-    result.queued = queued;
-    result.queuedClip = queuedClip;
-    result.queuedFade = queuedFade;
-    result.speed = speed;
+    result.next = (State)t.next;
+    result.nextClip = t.nextClip;
+    result.nextFade = t.nextFade;
+    result.queued = (State)t.queued;
+    result.queuedClip = t.queuedClip;
+    result.queuedFade = t.queuedFade;
+    result.speed = t.speed;
 }
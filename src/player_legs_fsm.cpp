@@ -1,9 +1,63 @@
 #include "../include/player_legs_fsm.h"
 
-#include "../include/player.h"
+namespace c_adv {
+
+    static constexpr int S(PlayerLegsFsm::State state) { return (int)state; }
+
+    static constexpr int Keep = FsmTransition::Keep;
+    static constexpr int None = FsmTransition::None;
+
+    static constexpr uint32_t OnSurface = FsmInput::OnSurface;
+    static constexpr uint32_t Hurt = FsmInput::Hurt;
+    static constexpr uint32_t Hanging = FsmInput::Hanging;
+    static constexpr uint32_t Alive = FsmInput::Alive;
+    static constexpr uint32_t Moving = FsmInput::Moving;
+    static constexpr uint32_t Slow = FsmInput::Slow;
+    static constexpr uint32_t FastFalling = FsmInput::FastFalling;
+
+    typedef PlayerLegsFsm::State State;
+
+    static constexpr FsmTransition LegsTransitions[] = {
+        // from, require, reject, next, fade, clip, queued, fade, clip, speed
+        { S(State::Running),      OnSurface,            Alive,         S(State::Dying),            20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Running),      OnSurface | Hurt,     0,             S(State::ImpactDamage),     20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Running),      OnSurface | Slow,     0,             S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Running),      OnSurface,            0,             Keep,                        0.0f, 0.0f,  S(State::Running),         0.0f, 0.0f,  1.0f },
+        { S(State::Running),      0,                    0,             S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+
+        { S(State::Falling),      OnSurface | Slow,     0,             S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Falling),      OnSurface,            0,             S(State::Running),          20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Falling),      FastFalling,          Hanging,       S(State::FastFalling),      40.0f, 0.0f,  S(State::FastFalling),     0.0f, 0.0f,  1.0f },
+        { S(State::Falling),      0,                    Hanging,       Keep,                        0.0f, 0.0f,  S(State::Falling),         0.0f, 0.0f,  1.0f },
+        { S(State::Falling),      0,                    0,             S(State::Hanging),          20.0f, 0.0f,  S(State::Hanging),         0.0f, 63.0f, 1.0f },
+
+        { S(State::FastFalling),  OnSurface | Slow,     0,             S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::FastFalling),  OnSurface,            0,             S(State::Running),          20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::FastFalling),  FastFalling,          Hanging,       Keep,                        0.0f, 0.0f,  S(State::FastFalling),     0.0f, 0.0f,  1.0f },
+        { S(State::FastFalling),  0,                    Hanging,       S(State::Falling),          20.0f, 0.0f,  S(State::Falling),         0.0f, 0.0f,  1.0f },
+        { S(State::FastFalling),  0,                    0,             S(State::Hanging),          20.0f, 0.0f,  S(State::Hanging),         0.0f, 63.0f, 1.0f },
+
+        { S(State::Idle),         OnSurface,            Alive,         S(State::Dying),            20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Idle),         OnSurface | Hurt,     0,             S(State::ImpactDamage),     20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Idle),         OnSurface | Moving,   0,             S(State::Running),          20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Idle),         OnSurface,            0,             Keep,                        0.0f, 0.0f,  S(State::Idle),            0.0f, 0.0f,  1.0f },
+        { S(State::Idle),         0,                    0,             S(State::Falling),          20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+
+        { S(State::ImpactDamage), 0,                    Hurt,          S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+
+        { S(State::Hanging),      OnSurface,            Hanging,       S(State::Idle),             20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Hanging),      0,                    Hanging,       S(State::Falling),          20.0f, 0.0f,  None,                      0.0f, 0.0f,  1.0f },
+        { S(State::Hanging),      0,                    0,             Keep,                        0.0f, 0.0f,  S(State::Hanging),         0.0f, 63.0f, 1.0f }
+    };
+
+} /* namespace c_adv */
+
+const c_adv::FsmTable c_adv::PlayerLegsFsm::Table(
+    LegsTransitions,
+    (int)(sizeof(LegsTransitions) / sizeof(LegsTransitions[0])),
+    (int)State::Undefined);
 
 c_adv::PlayerLegsFsm::PlayerLegsFsm() {
-    m_player = nullptr;
     m_currentState = State::Idle;
 }
 
@@ -11,173 +65,13 @@ c_adv::PlayerLegsFsm::~PlayerLegsFsm() {
     /* void */
 }
 
-void c_adv::PlayerLegsFsm::initialize(Player *player) {
-    m_player = player;
-}
+void c_adv::PlayerLegsFsm::nextState(uint32_t inputs, FsmResults &result) {
+    const FsmTransition t = Table.evaluate((int)m_currentState, inputs);
 
-void c_adv::PlayerLegsFsm::nextState(FsmResults &result) {
-    ysVector velocity = m_player->RigidBody.GetVelocity();
-
-    // FSM inputs
-    const State current = m_currentState;
-    const bool onSurface = m_player->m_walkComponent.isOnSurface();
-    const bool isHurt = m_player->isHurt();
-    const bool isHanging = m_player->isHanging();
-    const bool isGraspReady = m_player->isGraspReady();
-    const bool isLaunching = m_player->isLaunching();
-    const bool isActionComplete = m_player->isCurrentArmActionComplete();
-    const float horizontalVelocity = ysMath::GetX(velocity);
-    const float fallSpeed = max(-ysMath::GetY(velocity), 0.0f);
-    const bool isMoving = std::abs(horizontalVelocity) > 1.0f;
-    const bool isAlive = m_player->isAlive();
-
-    // FSM Output
-    State next = current;
-    State queued = State::Undefined;
-
-    float nextFade = 0.0f;
-    float nextClip = 0.0f;
-    float queuedFade = 0.0f;
-    float queuedClip = 0.0f;
-
-    // FSM
-    if (current == State::Running) {
-        if (onSurface) {
-            if (!isAlive) {
-                next = State::Dying;
-                nextFade = 20.0f;
-            }
-            else if (isHurt) {
-                next = State::ImpactDamage;
-                nextFade = 20.0f;
-            }
-            else if (std::abs(horizontalVelocity) < 1.0f) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-            else {
-                queued = State::Running;
-            }
-        }
-        else {
-            next = State::Idle;
-            nextFade = 20.0f;
-        }
-    }
-    else if (current == State::Falling) {
-        if (onSurface) {
-            if (std::abs(horizontalVelocity) < 1.0f) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-            else {
-                next = State::Running;
-                nextFade = 20.0f;
-            }
-        }
-        else if (!isHanging) {
-            if (fallSpeed > 9.0f) {
-                next = State::FastFalling;
-                nextFade = 40.0f;
-
-                queued = State::FastFalling;
-            }
-            else {
-                queued = State::Falling;
-            }
-        }
-        else {
-            next = State::Hanging;
-            nextFade = 20.0f;
-
-            queued = State::Hanging;
-            queuedFade = 0.0f;
-            queuedClip = 63.0f;
-        }
-    }
-    else if (current == State::FastFalling) {
-        if (onSurface) {
-            if (std::abs(horizontalVelocity) < 1.0f) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-            else {
-                next = State::Running;
-                nextFade = 20.0f;
-            }
-        }
-        else if (!isHanging) {
-            if (fallSpeed > 9.0f) {
-                queued = State::FastFalling;
-            }
-            else {
-                next = State::Falling;
-                nextFade = 20.0f;
-
-                queued = State::Falling;
-            }
-        }
-        else {
-            next = State::Hanging;
-            nextFade = 20.0f;
-
-            queued = State::Hanging;
-            queuedFade = 0.0f;
-            queuedClip = 63.0f;
-        }
-    }
-    else if (current == State::Idle) {
-        if (onSurface) {
-            if (!isAlive) {
-                next = State::Dying;
-                nextFade = 20.0f;
-            }
-            else if (isHurt) {
-                next = State::ImpactDamage;
-                nextFade = 20.0f;
-            }
-            else if (std::abs(horizontalVelocity) > 1.0f) {
-                next = State::Running;
-                nextFade = 20.0f;
-            }
-            else {
-                queued = State::Idle;
-            }
-        }
-        else {
-            next = State::Falling;
-            nextFade = 20.0f;
-        }
-    }
-    else if (current == State::ImpactDamage) {
-        if (!isHurt) {
-            next = State::Idle;
-            nextFade = 20.0f;
-        }
-    }
-    else if (current == State::Hanging) {
-        if (!isHanging) {
-            if (onSurface) {
-                next = State::Idle;
-                nextFade = 20.0f;
-            }
-            else {
-                next = State::Falling;
-                nextFade = 20.0f;
-            }
-        }
-        else {
-            queued = State::Hanging;
-            queuedFade = 0.0f;
-            queuedClip = 63.0f;
-        }
-    }
-
-    // Output
-    result.next = next;
-    result.nextClip = nextClip;
-    result.nextFade = nextFade;
-    result.queued = queued;
-    result.queuedClip = queuedClip;
-    result.queuedFade = queuedFade;
+    result.next = (State)t.next;
+    result.nextClip = t.nextClip;
+    result.nextFade = t.nextFade;
+    result.queued = (State)t.queued;
+    result.queuedClip = t.queuedClip;
+    result.queuedFade = t.queuedFade;
 }
@@ -1,6 +1,7 @@
 #include "../include/projectile_damage_component.h"
 
 #include "../include/player.h"
+#include "../include/realm.h"
 
 c_adv::ProjectileDamageComponent::ProjectileDamageComponent() {
     m_player = nullptr;
@@ -12,27 +13,19 @@ c_adv::ProjectileDamageComponent::~ProjectileDamageComponent() {
 
 void c_adv::ProjectileDamageComponent::initialize(Player *player) {
     m_player = player;
+    m_player->addContactListener([this](const ContactEvent &contact) { onContact(contact); });
 }
 
-void c_adv::ProjectileDamageComponent::process(float dt) {
+void c_adv::ProjectileDamageComponent::onContact(const ContactEvent &contact) {
+    if (contact.type != ContactEvent::Type::Begin) return;
     if (!m_player->isAlive()) return;
 
-    int collisionCount = m_player->RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *collision = m_player->RigidBody.GetCollision(i);
-        if (collision->m_sensor || collision->IsGhost()) continue;
+    GameObject *object = contact.other;
+    if (!object->hasTag(GameObject::Tag::Projectile)) return;
+    if (!object->isDangerous()) return;
 
-        GameObject *object = m_player->getCollidingObject(collision);
-        if (!object->hasTag(GameObject::Tag::Projectile)) continue;
-        if (!object->isDangerous()) continue;
+    ysVector collisionVelocity = ysMath::Mask(ysMath::Negate(contact.closingVelocity), ysMath::Constants::MaskKeepX);
+    collisionVelocity = ysMath::Clamp(collisionVelocity, ysMath::LoadScalar(-5.0f), ysMath::LoadScalar(5.0f));
 
-        ysVector collisionVelocity = ysMath::Mask(m_player->getCollisionVelocity(collision), ysMath::Constants::MaskKeepX);
-        collisionVelocity = ysMath::Clamp(collisionVelocity, ysMath::LoadScalar(-5.0f), ysMath::LoadScalar(5.0f));
-
-        m_player->RigidBody.AddImpulseWorldSpace(
-            collisionVelocity,
-            m_player->RigidBody.Transform.GetWorldPosition()
-        );
-        m_player->takeDamage(1.0f);
-    }
+    m_player->getRealm()->queueDamage({ object, m_player, 1.0f, collisionVelocity });
 }
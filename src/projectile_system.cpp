@@ -0,0 +1,269 @@
+#include "../include/projectile_system.h"
+
+#include "../include/player.h"
+#include "../include/realm.h"
+#include "../include/world.h"
+
+#include <float.h>
+
+c_adv::ProjectileSystem::ProjectileSystem() {
+    /* void */
+}
+
+c_adv::ProjectileSystem::~ProjectileSystem() {
+    /* void */
+}
+
+void c_adv::ProjectileSystem::emit(const Projectile &projectile) {
+    m_x.push_back(projectile.x);
+    m_y.push_back(projectile.y);
+    m_prevX.push_back(projectile.x);
+    m_prevY.push_back(projectile.y);
+    m_vx.push_back(projectile.velocityX);
+    m_vy.push_back(projectile.velocityY);
+    m_angle.push_back(projectile.angle);
+    m_angularVelocity.push_back(projectile.angularVelocity);
+    m_radius.push_back(projectile.radius);
+    m_gravity.push_back(projectile.gravity);
+    m_age.push_back(0.0f);
+    m_lifespan.push_back(projectile.lifespan);
+    m_bounce.push_back(projectile.bounce ? 1 : 0);
+    m_dangerous.push_back(projectile.dangerous ? 1 : 0);
+    m_dead.push_back(0);
+    m_model.push_back(projectile.model);
+    m_color.push_back(ysMath::GetVector4(
+        (projectile.color != nullptr) ? *projectile.color : ysMath::Constants::Zero));
+}
+
+void c_adv::ProjectileSystem::clear() {
+    m_x.clear(); m_y.clear();
+    m_prevX.clear(); m_prevY.clear();
+    m_vx.clear(); m_vy.clear();
+    m_angle.clear(); m_angularVelocity.clear();
+    m_radius.clear();
+    m_gravity.clear();
+    m_age.clear(); m_lifespan.clear();
+    m_bounce.clear();
+    m_dangerous.clear();
+    m_dead.clear();
+    m_model.clear();
+    m_color.clear();
+}
+
+void c_adv::ProjectileSystem::update(float dt, Realm *realm) {
+    if (m_x.empty()) return;
+
+    integrate(dt);
+    collide(realm);
+    removeExpired();
+}
+
+void c_adv::ProjectileSystem::render(Realm *realm, const AABB &extents) {
+    World *world = realm->getWorld();
+    Shaders &shaders = world->getShaders();
+
+    const float minX = ysMath::GetX(extents.minPoint), minY = ysMath::GetY(extents.minPoint);
+    const float maxX = ysMath::GetX(extents.maxPoint), maxY = ysMath::GetY(extents.maxPoint);
+
+    const int N = getCount();
+    for (int i = 0; i < N; ++i) {
+        if (m_model[i] == nullptr) continue;
+        if (m_x[i] < minX || m_x[i] > maxX || m_y[i] < minY || m_y[i] > maxY) continue;
+
+        const ysMatrix transform = ysMath::MatMult(
+            ysMath::TranslationTransform(ysMath::LoadVector(m_x[i], m_y[i], 0.0f)),
+            ysMath::RotationTransform(ysMath::Constants::ZAxis, m_angle[i]));
+
+        shaders.ResetBrdfParameters();
+        const ysVector4 &color = m_color[i];
+        shaders.SetBaseColor(ysMath::LoadVector(color.x, color.y, color.z, color.w));
+
+        shaders.SetObjectTransform(transform);
+        shaders.ConfigureModel(1.0f, m_model[i]);
+        world->getEngine().DrawModel(shaders.GetRegularFlags(), m_model[i]);
+    }
+}
+
+void c_adv::ProjectileSystem::integrate(float dt) {
+    const int N = getCount();
+
+    float *x = m_x.data(), *y = m_y.data();
+    float *px = m_prevX.data(), *py = m_prevY.data();
+    float *vx = m_vx.data(), *vy = m_vy.data();
+    float *angle = m_angle.data();
+    float *age = m_age.data();
+    const float *w = m_angularVelocity.data();
+    const float *g = m_gravity.data();
+
+    for (int i = 0; i < N; ++i) {
+        px[i] = x[i];
+        py[i] = y[i];
+
+        vy[i] -= g[i] * dt;
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+
+        angle[i] += w[i] * dt;
+        age[i] += dt;
+    }
+}
+
+void c_adv::ProjectileSystem::collide(Realm *realm) {
+    const int N = getCount();
+
+    // One query gathers every player that any projectile could reach
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+    for (int i = 0; i < N; ++i) {
+        minX = min(minX, min(m_x[i], m_prevX[i]) - m_radius[i]);
+        minY = min(minY, min(m_y[i], m_prevY[i]) - m_radius[i]);
+        maxX = max(maxX, max(m_x[i], m_prevX[i]) + m_radius[i]);
+        maxY = max(maxY, max(m_y[i], m_prevY[i]) + m_radius[i]);
+    }
+
+    m_targets.clear();
+    realm->overlapBox(
+        { ysMath::LoadVector(minX, minY, 0.0f, 1.0f), ysMath::LoadVector(maxX, maxY, 0.0f, 1.0f) },
+        m_targets,
+        GameObject::Tag::Player);
+
+    for (int i = 0; i < N; ++i) {
+        const AABB swept = {
+            ysMath::LoadVector(min(m_x[i], m_prevX[i]) - m_radius[i], min(m_y[i], m_prevY[i]) - m_radius[i], 0.0f, 1.0f),
+            ysMath::LoadVector(max(m_x[i], m_prevX[i]) + m_radius[i], max(m_y[i], m_prevY[i]) + m_radius[i], 0.0f, 1.0f) };
+
+        GameObject *hitObject = nullptr;
+        float hitT = FLT_MAX, normalX = 0.0f, normalY = 0.0f;
+
+        for (GameObject *target : m_targets) {
+            float t, nx, ny;
+            if (sweep(i, target->getVisualBounds(), &t, &nx, &ny) && t < hitT) {
+                hitObject = target;
+                hitT = t; normalX = nx; normalY = ny;
+            }
+        }
+
+        m_obstacles.clear();
+        realm->queryStaticObjects(swept, m_obstacles);
+
+        bool hitStatic = false;
+        for (GameObject *obstacle : m_obstacles) {
+            // Scenery without collision geometry can't be hit
+            if (obstacle->RigidBody.CollisionGeometry.GetNumObjects() == 0) continue;
+
+            float t, nx, ny;
+            if (sweep(i, obstacle->getVisualBounds(), &t, &nx, &ny) && t < hitT) {
+                hitObject = nullptr;
+                hitStatic = true;
+                hitT = t; normalX = nx; normalY = ny;
+            }
+        }
+
+        if (hitObject == nullptr && !hitStatic) continue;
+
+        if (hitObject != nullptr && m_dangerous[i] && static_cast<Player *>(hitObject)->isAlive()) {
+            const float impulse = min(max(m_vx[i], -5.0f), 5.0f);
+            realm->queueDamage({ nullptr, hitObject, 1.0f, ysMath::LoadVector(impulse, 0.0f, 0.0f) });
+        }
+
+        const float hx = m_prevX[i] + (m_x[i] - m_prevX[i]) * hitT;
+        const float hy = m_prevY[i] + (m_y[i] - m_prevY[i]) * hitT;
+
+        if (!m_bounce[i] || hitObject != nullptr) {
+            m_dead[i] = 1;
+            continue;
+        }
+
+        // Reflect the normal component and stop just off the surface so the
+        // next sweep starts outside of the object
+        const float vn = m_vx[i] * normalX + m_vy[i] * normalY;
+        m_vx[i] -= (1 + Restitution) * vn * normalX;
+        m_vy[i] -= (1 + Restitution) * vn * normalY;
+        m_x[i] = hx + normalX * SurfaceOffset;
+        m_y[i] = hy + normalY * SurfaceOffset;
+        m_dangerous[i] = 0;
+
+        // Projectiles that barely rebound off a floor stop there. Gravity
+        // still pulls them down every step, so they fall again as soon as
+        // the floor is gone.
+        if (normalY > 0.0f && std::abs(vn) * Restitution < RestSpeed) {
+            m_vx[i] = m_vy[i] = 0.0f;
+            m_angularVelocity[i] = 0.0f;
+        }
+    }
+}
+
+void c_adv::ProjectileSystem::removeExpired() {
+    for (int i = 0; i < getCount(); ++i) {
+        if (m_dead[i]
+            || m_age[i] >= m_lifespan[i]
+            || std::abs(m_x[i]) > DespawnX
+            || std::abs(m_y[i]) > DespawnY)
+        {
+            removeSwap(i--);
+        }
+    }
+}
+
+void c_adv::ProjectileSystem::removeSwap(int index) {
+    std::vector<float> *floats[] = {
+        &m_x, &m_y, &m_prevX, &m_prevY, &m_vx, &m_vy,
+        &m_angle, &m_angularVelocity, &m_radius, &m_gravity, &m_age, &m_lifespan };
+    for (std::vector<float> *a : floats) {
+        (*a)[index] = a->back(); a->pop_back();
+    }
+
+    std::vector<unsigned char> *flags[] = { &m_bounce, &m_dangerous, &m_dead };
+    for (std::vector<unsigned char> *a : flags) {
+        (*a)[index] = a->back(); a->pop_back();
+    }
+
+    m_model[index] = m_model.back(); m_model.pop_back();
+    m_color[index] = m_color.back(); m_color.pop_back();
+}
+
+bool c_adv::ProjectileSystem::sweep(
+    int index, const AABB &bounds, float *t, float *normalX, float *normalY) const
+{
+    // Moving circle against a box is treated as a moving point against the
+    // box grown by the radius
+    const float r = m_radius[index];
+    const float b0[] = { ysMath::GetX(bounds.minPoint) - r, ysMath::GetY(bounds.minPoint) - r };
+    const float b1[] = { ysMath::GetX(bounds.maxPoint) + r, ysMath::GetY(bounds.maxPoint) + r };
+    const float o[] = { m_prevX[index], m_prevY[index] };
+    const float d[] = { m_x[index] - m_prevX[index], m_y[index] - m_prevY[index] };
+
+    // Projectiles that start inside an object are leaving it
+    if (o[0] > b0[0] && o[0] < b1[0] && o[1] > b0[1] && o[1] < b1[1]) return false;
+
+    float t0 = 0.0f, t1 = 1.0f;
+    int axis = -1;
+    float sign = 0.0f;
+    for (int i = 0; i < 2; ++i) {
+        if (std::abs(d[i]) < 1E-6f) {
+            if (o[i] < b0[i] || o[i] > b1[i]) return false;
+            continue;
+        }
+
+        float tNear = (b0[i] - o[i]) / d[i];
+        float tFar = (b1[i] - o[i]) / d[i];
+        if (tNear > tFar) std::swap(tNear, tFar);
+
+        // A projectile resting on the boundary still enters along this axis
+        if (tNear >= t0) {
+            t0 = tNear;
+            axis = i;
+            sign = (d[i] > 0) ? -1.0f : 1.0f;
+        }
+
+        t1 = min(t1, tFar);
+        if (t0 > t1) return false;
+    }
+
+    if (axis == -1) return false;
+
+    *t = t0;
+    *normalX = (axis == 0) ? sign : 0.0f;
+    *normalY = (axis == 1) ? sign : 0.0f;
+
+    return true;
+}
@@ -3,13 +3,30 @@
 #include "../include/game_object.h"
 #include "../include/world.h"
 #include "../include/colors.h"
+#include "../include/culling.h"
+#include "../include/math_utilities.h"
+
+#include <algorithm>
+#include <float.h>
 
 c_adv::Realm::Realm() {
     m_exitPortal = nullptr;
     m_world = nullptr;
     m_indoor = false;
 
+    m_idleTime = 0.0f;
+    m_hibernating = false;
+    m_initializingObjects = false;
+
     m_visibleObjectCount = 0;
+    m_frameIndex = 0;
+    m_staticGridDirty = false;
+    m_minStaticThickness = FLT_MAX;
+    m_sleepingObjectCount = 0;
+    m_minPhysicsSubsteps = 1;
+    m_maxPhysicsSubsteps = MaxPhysicsSubsteps;
+    m_ledgeIndexDirty = false;
+    m_nextTickPhase = 0;
 
     initializeFrictionTable();
 }
@@ -22,10 +39,32 @@ void c_adv::Realm::registerGameObject(GameObject *object) {
     assert(static_cast<GameObject *>(object->RigidBody.GetOwner()) == object);
 
     object->setRealm(this);
+
+    if (object->hasTag(GameObject::Tag::Static)) object->setCollisionLayer(GameObject::Layer::Static);
+    m_collisionMatrix.apply(object);
+    PhysicsSystem.RegisterRigidBody(&object->RigidBody);
+
+    if (object->hasContactListeners()) {
+        object->getContactSet().clear();
+        m_contactSubscribers.push_back(object);
+    }
+
+    if (object->hasTag(GameObject::Tag::Ledge)) m_ledgeIndexDirty = true;
+
+    if (object->hasTag(GameObject::Tag::Static)) {
+        object->setRealmRecordIndex((int)m_staticObjects.size());
+        m_staticObjects.push_back(object);
+        m_staticGridDirty = true;
+        return;
+    }
+
     object->setRealmRecordIndex((int)m_gameObjects.size());
+    object->setTickPhase(m_nextTickPhase++);
     m_gameObjects.push_back(object);
 
-    PhysicsSystem.RegisterRigidBody(&object->RigidBody);
+    object->updateTransformCache();
+    object->createVisualBounds();
+    m_dynamicBounds.push(object->getVisualBounds());
 }
 
 void c_adv::Realm::unregisterGameObject(GameObject *object) {
@@ -34,53 +73,130 @@ void c_adv::Realm::unregisterGameObject(GameObject *object) {
     object->setRealmRecordIndex(-1);
     PhysicsSystem.RemoveRigidBody(&object->RigidBody);
 
-    m_gameObjects[index] = m_gameObjects.back();
-    m_gameObjects[index]->setRealmRecordIndex(index);
-    m_gameObjects.pop_back();
+    if (object->hasTag(GameObject::Tag::Ledge)) m_ledgeIndexDirty = true;
+    m_forceFields.removeField(object);
+    discardEvents(object);
+
+    std::vector<GameObject *> &list = object->hasTag(GameObject::Tag::Static)
+        ? m_staticObjects
+        : m_gameObjects;
+
+    list[index] = list.back();
+    list[index]->setRealmRecordIndex(index);
+    list.pop_back();
+
+    if (&list == &m_staticObjects) m_staticGridDirty = true;
+    else m_dynamicBounds.removeSwap(index);
 }
 
 void c_adv::Realm::process(float dt) {
     spawnObjects();
     respawnObjects();
 
+    if (m_frameIndex % MortonSortInterval == 0) {
+        sortDynamicObjects();
+    }
+
+    dispatchContacts();
+
+    m_timers.advance(dt);
+
     for (GameObject *g : m_gameObjects) {
         g->resetAccumulators();
     }
 
+    updateSleep();
+
+    const AABB cameraExtents = m_world->getCameraExtents();
     for (GameObject *g : m_gameObjects) {
-        g->createVisualBounds();
-        g->process(dt);
+        if (g->isSleeping()) continue;
+
+        if (!g->isTickLodEnabled()) {
+            g->process(dt);
+            continue;
+        }
+
+        g->setTickInterval(computeTickInterval(g, cameraExtents));
+
+        float tickDt;
+        if (g->accumulateTick(dt, m_frameIndex, &tickDt)) {
+            g->process(tickDt);
+        }
     }
 
+    m_forceFields.apply(this);
+    m_projectiles.update(dt, this);
+    m_mobs.update(dt, this);
+
+    dispatchDamage();
+
+    ++m_frameIndex;
+
     cleanObjectList();
+}
+
+void c_adv::Realm::updatePhysics(float dt) {
+    // Forces persist until the next process() so every substep sees them
+    const int substeps = computePhysicsSubsteps(dt);
+    m_physicsStats.substeps = substeps;
+
+    const float h = dt / substeps;
+    for (int i = 0; i < substeps; ++i) {
+        PhysicsSystem.Update(h);
+    }
 
-    m_world->getEngine().GetBreakdownTimer().StartMeasurement(World::PhysicsTimer);
-    {
-        PhysicsSystem.Update(dt);
+    collectContacts();
+    updatePhysicsStats();
+
+    const int N = (int)m_gameObjects.size();
+    for (int i = 0; i < N; ++i) {
+        GameObject *g = m_gameObjects[i];
+        if (!g->updateTransformCache()) continue;
+
+        g->createVisualBounds();
+        m_dynamicBounds.set(i, g->getVisualBounds());
     }
-    m_world->getEngine().GetBreakdownTimer().EndMeasurement(World::PhysicsTimer);
 }
  
 void c_adv::Realm::render() {
+    const ysVector margin = ysMath::LoadScalar(CullingMargin);
+
     AABB cameraExtents = m_world->getCameraExtents();
+    cameraExtents.minPoint = ysMath::Sub(cameraExtents.minPoint, margin);
+    cameraExtents.maxPoint = ysMath::Add(cameraExtents.maxPoint, margin);
+
+    const BoundsBuffer &staticBounds = getStaticBounds();
+    const int staticCount = staticBounds.size();
+
+    m_visibleIndices.clear();
+    cullBounds(staticBounds, cameraExtents, m_visibleIndices);
+    cullBounds(m_dynamicBounds, cameraExtents, m_visibleIndices, staticCount);
+
     int visibleObjects = 0;
-    for (GameObject *g : m_gameObjects) {
+    for (int index : m_visibleIndices) {
+        GameObject *g = (index < staticCount)
+            ? m_staticObjects[index]
+            : m_gameObjects[index - staticCount];
         if (g->getDeletionFlag()) continue;
-        AABB extents = g->getVisualBounds();
 
-        if (extents.intersects2d(cameraExtents) || true) {
-            g->render();
-            ++visibleObjects;
-        }
+        g->render();
+        ++visibleObjects;
     }
 
+    m_projectiles.render(this, cameraExtents);
+    m_mobs.render(this, cameraExtents);
+
     m_visibleObjectCount = visibleObjects;
 }
 
 void c_adv::Realm::spawnObjects() {
     while (!m_spawnQueue.empty()) {
         GameObject *u = m_spawnQueue.front(); m_spawnQueue.pop();
+
+        m_initializingObjects = true;
         u->initialize();
+        m_initializingObjects = false;
+
         registerGameObject(u);
     }
 }
@@ -96,36 +212,251 @@ dbasic::DeltaEngine &c_adv::Realm::getEngine() {
     return m_world->getEngine();
 }
 
+void c_adv::Realm::queueTransfer(GameObject *object) {
+    m_transferQueue.push(object);
+}
+
 void c_adv::Realm::updateRealms() {
-    int N = (int)m_gameObjects.size();
+    const int N = (int)m_transferQueue.size();
     for (int i = 0; i < N; ++i) {
-        if (m_gameObjects[i]->isChangingRealm()) {
-            GameObject *object = m_gameObjects[i];
-            Realm *newRealm = object->getNewRealm();
-            object->resetRealmChange();
+        GameObject *object = m_transferQueue.front(); m_transferQueue.pop();
+        if (!object->isChangingRealm() || object->isDead()) continue;
 
-            unregisterGameObject(object);
+        // Objects still waiting in the spawn queue are transferred once they
+        // have been registered
+        if (object->getRealmRecordIndex() == -1) {
+            if (!object->isReal()) m_transferQueue.push(object);
+            else object->resetRealmChange();
 
-            if (newRealm != nullptr) {
-                newRealm->registerGameObject(object);
-            }
+            continue;
+        }
+
+        Realm *newRealm = object->getNewRealm();
+        object->resetRealmChange();
+
+        unregisterGameObject(object);
+
+        if (newRealm != nullptr) {
+            if (newRealm->isHibernating()) newRealm->restore();
+            m_timers.moveAll(object, &newRealm->m_timers);
+            newRealm->registerGameObject(object);
+        }
+        else {
+            m_timers.cancelAll(object);
+        }
 
-            GameObject *lastPortal = object->getLastPortal();
-            object->setLastPortal(nullptr);
+        GameObject *lastPortal = object->getLastPortal();
+        object->setLastPortal(nullptr);
 
-            if (lastPortal != nullptr) {
-                if (newRealm == lastPortal->getTargetRealm()) {
-                    lastPortal->onEnter(object);
-                }
-                else if (newRealm == lastPortal->getRealm()) {
-                    lastPortal->onExit(object);
-                }
+        if (lastPortal != nullptr) {
+            if (newRealm == lastPortal->resolveTargetRealm()) {
+                lastPortal->onEnter(object);
+            }
+            else if (newRealm == lastPortal->getRealm()) {
+                lastPortal->onExit(object);
             }
+        }
+    }
+}
+
+void c_adv::Realm::setExitPortal(GameObject *portal) {
+    if (m_exitPortal != nullptr) m_exitPortal->decrementReferenceCount();
+    if (portal != nullptr) portal->incrementReferenceCount();
+
+    m_exitPortal = portal;
+}
+
+bool c_adv::Realm::canHibernate() const {
+    if (m_hibernating) return false;
+    if (!m_spawnQueue.empty() || !m_respawnQueue.empty() || !m_unloadQueue.empty()) return false;
+    if (!m_transferQueue.empty()) return false;
+    if (!m_deadObjects.empty()) return false;
+
+    for (GameObject *g : m_gameObjects) {
+        if (g->getReferenceCount() > 0) return false;
+    }
+
+    for (GameObject *g : m_staticObjects) {
+        if (g->getReferenceCount() > 0) return false;
+    }
+
+    return true;
+}
+
+void c_adv::Realm::hibernate() {
+    m_hibernationArchive.clear();
+
+    std::vector<GameObject *> objects = m_staticObjects;
+    objects.insert(objects.end(), m_gameObjects.begin(), m_gameObjects.end());
 
-            --i;
-            N = (int)m_gameObjects.size();
+    int archived = 0;
+    for (GameObject *g : objects) {
+        if (g->getTypeId() >= 0) ++archived;
+    }
+
+    m_hibernationArchive.write(archived);
+    for (GameObject *g : objects) {
+        if (g->getTypeId() < 0) continue;
+
+        m_hibernationArchive.write(g->getTypeId());
+        g->saveState(m_hibernationArchive);
+    }
+
+    m_mobs.saveState(m_hibernationArchive);
+
+    for (GameObject *g : objects) {
+        g->setRealmRecordIndex(-1);
+        PhysicsSystem.RemoveRigidBody(&g->RigidBody);
+        destroyObject(g);
+    }
+
+    std::vector<GameObject *>().swap(m_gameObjects);
+    std::vector<GameObject *>().swap(m_staticObjects);
+    std::vector<GameObject *>().swap(m_deadObjects);
+
+    m_dynamicBounds.clear();
+    m_staticBounds.clear();
+    m_staticGrid.clear();
+    m_staticGridDirty = false;
+
+    m_ledgeIndex.clear();
+    m_ledgeIndexDirty = false;
+
+    m_forceFields.clear();
+    m_timers.clear();
+    m_projectiles.clear();
+    m_mobs.clear();
+    m_contactSubscribers.clear();
+    m_contactEvents.clear();
+    m_damageQueue.clear();
+
+    m_hibernating = true;
+}
+
+void c_adv::Realm::restore() {
+    m_hibernationArchive.rewind();
+
+    const int objectCount = m_hibernationArchive.read<int>();
+    for (int i = 0; i < objectCount; ++i) {
+        const int typeId = m_hibernationArchive.read<int>();
+
+        GameObject *newObject = ObjectRegistry::create(typeId);
+        newObject->setTypeId(typeId);
+        newObject->setWorld(m_world);
+        newObject->setRealm(this);
+        newObject->loadState(m_hibernationArchive);
+
+        addToSpawnQueue(newObject);
+    }
+
+    m_mobs.loadState(m_hibernationArchive);
+
+    m_hibernationArchive.clear();
+    m_hibernating = false;
+    m_idleTime = 0.0f;
+}
+
+void c_adv::Realm::captureSnapshot(RealmSnapshot &snapshot) {
+    snapshot.clear();
+    StateArchive &archive = snapshot.getArchive();
+
+    // Agents are saved ahead of the object records so that a mob that is
+    // promoted or demoted after the capture is restored on the right side
+    m_mobs.saveState(archive);
+
+    for (GameObject *g : m_gameObjects) {
+        if (g->getDeletionFlag()) continue;
+
+        RealmSnapshot::Record record;
+        record.objectId = g->getObjectId();
+        record.typeId = g->getTypeId();
+        record.stateOffset = archive.getSize();
+        g->saveState(archive);
+        record.runtimeOffset = archive.getSize();
+        g->saveRuntimeState(archive);
+
+        snapshot.addRecord(record);
+    }
+}
+
+void c_adv::Realm::restoreSnapshot(RealmSnapshot &snapshot) {
+    StateArchive &archive = snapshot.getArchive();
+
+    archive.rewind();
+    m_mobs.loadState(archive);
+
+    m_snapshotLookup.clear();
+    for (GameObject *g : m_gameObjects) {
+        m_snapshotLookup[g->getObjectId()] = g;
+    }
+
+    for (const RealmSnapshot::Record &record : snapshot.getRecords()) {
+        auto it = m_snapshotLookup.find(record.objectId);
+        if (it != m_snapshotLookup.end()) {
+            GameObject *g = it->second;
+            m_snapshotLookup.erase(it);
+
+            archive.seek(record.stateOffset);
+            g->loadState(archive);
+            archive.seek(record.runtimeOffset);
+            g->loadRuntimeState(archive);
+            g->resetAccumulators();
+
+            continue;
         }
+
+        // Children are recreated by their parent and objects that moved to
+        // another realm are left where they are
+        if (record.typeId < 0) continue;
+        if (m_world->findObject(record.objectId) != nullptr) continue;
+
+        GameObject *newObject = ObjectRegistry::create(record.typeId);
+        newObject->setObjectId(record.objectId);
+        newObject->setTypeId(record.typeId);
+        newObject->setWorld(m_world);
+        newObject->setRealm(this);
+
+        archive.seek(record.stateOffset);
+        newObject->loadState(archive);
+
+        addToSpawnQueue(newObject);
+    }
+
+    for (const auto &entry : m_snapshotLookup) {
+        if (entry.second->getReferenceCount() == 0) entry.second->setDeletionFlag();
+    }
+
+    m_projectiles.clear();
+    m_contactEvents.clear();
+    m_damageQueue.clear();
+}
+
+void c_adv::Realm::revive(GameObject *object) {
+    auto dead = std::find(m_deadObjects.begin(), m_deadObjects.end(), object);
+    if (dead != m_deadObjects.end()) {
+        *dead = m_deadObjects.back();
+        m_deadObjects.pop_back();
     }
+
+    object->revive();
+    registerGameObject(object);
+}
+
+c_adv::GameObject *c_adv::Realm::findObject(unsigned int objectId) const {
+    for (GameObject *g : m_gameObjects) {
+        if (g->getObjectId() == objectId) return g;
+    }
+
+    for (GameObject *g : m_deadObjects) {
+        if (g->getObjectId() == objectId) return g;
+    }
+
+    return nullptr;
+}
+
+void c_adv::Realm::updatePresence(bool present, float dt) {
+    if (present) m_idleTime = 0.0f;
+    else m_idleTime += dt;
 }
 
 void c_adv::Realm::unload(GameObject *object) {
@@ -141,11 +472,24 @@ void c_adv::Realm::addToSpawnQueue(GameObject *object) {
 }
 
 void c_adv::Realm::cleanObjectList() {
+    int N_static = (int)m_staticObjects.size();
+    for (int i = 0; i < N_static; ++i) {
+        if (m_staticObjects[i]->getDeletionFlag()) {
+            m_staticObjects[i]->setDead();
+            m_deadObjects.push_back(m_staticObjects[i]);
+            m_timers.cancelAll(m_staticObjects[i]);
+            unregisterGameObject(m_staticObjects[i]);
+
+            --i; --N_static;
+        }
+    }
+
     int N = (int)m_gameObjects.size();
     for (int i = 0; i < N; ++i) {
         if (m_gameObjects[i]->getDeletionFlag()) {
             m_gameObjects[i]->setDead();
             m_deadObjects.push_back(m_gameObjects[i]);
+            m_timers.cancelAll(m_gameObjects[i]);
             unregisterGameObject(m_gameObjects[i]);
 
             --i; --N;
@@ -172,9 +516,426 @@ void c_adv::Realm::cleanObjectList() {
 }
 
 void c_adv::Realm::destroyObject(GameObject *object) {
+    object->~GameObject();
     _aligned_free((void *)object);
 }
 
+int c_adv::Realm::computeTickInterval(GameObject *object, const AABB &cameraExtents) const {
+    const float width = ysMath::GetX(cameraExtents.maxPoint) - ysMath::GetX(cameraExtents.minPoint);
+    const float height = ysMath::GetY(cameraExtents.maxPoint) - ysMath::GetY(cameraExtents.minPoint);
+    const float range = max(width, height) * 0.5f;
+
+    const float d = cameraExtents.distance2d(object->RigidBody.Transform.GetWorldPosition());
+    if (d <= 0.0f) return 1;
+    else if (d < range) return 2;
+    else if (d < 2 * range) return 4;
+    else return 8;
+}
+
+void c_adv::Realm::updateSleep() {
+    m_sleepingObjectCount = 0;
+
+    // Wake regions are indexed once per tick so that each awake body only
+    // visits the regions around it
+    const int N = (int)m_gameObjects.size();
+    m_wakeFlags.assign(N, 0);
+    m_wakeGrid.clear();
+
+    bool anySleepers = false;
+    for (int i = 0; i < N; ++i) {
+        GameObject *g = m_gameObjects[i];
+        if (!g->isSleepEnabled()) continue;
+
+        if (!g->canSleep()) {
+            m_wakeFlags[i] = 1;
+            continue;
+        }
+
+        m_wakeGrid.insert(i, g->getWakeRegionWorld());
+        anySleepers = true;
+    }
+
+    for (int i = 0; i < N && anySleepers; ++i) {
+        GameObject *other = m_gameObjects[i];
+        if (other->isSleeping() || other->getDeletionFlag()) continue;
+        if (!other->hasTag(GameObject::Tag::Player) && !other->hasTag(GameObject::Tag::Dynamic)) continue;
+
+        const AABB &bounds = other->getVisualBounds();
+
+        m_wakeQuery.clear();
+        m_wakeGrid.query(bounds, m_wakeQuery);
+
+        for (int index : m_wakeQuery) {
+            if (index == i || m_wakeFlags[index]) continue;
+            if (m_gameObjects[index]->getWakeRegionWorld().intersects2d(bounds)) m_wakeFlags[index] = 1;
+        }
+    }
+
+    for (int i = 0; i < N; ++i) {
+        GameObject *g = m_gameObjects[i];
+        if (!g->isSleepEnabled()) continue;
+
+        const bool awake = m_wakeFlags[i] != 0;
+        if (!awake) {
+            if (!g->isSleeping()) m_forceFields.removeField(g);
+            ++m_sleepingObjectCount;
+        }
+
+        g->setSleeping(!awake);
+    }
+}
+
+void c_adv::Realm::collectContacts() {
+    for (GameObject *object : m_contactSubscribers) {
+        std::vector<GameObject *> &previous = object->getContactSet();
+        m_contactScratch.clear();
+
+        const int collisionCount = object->RigidBody.GetCollisionCount();
+        for (int i = 0; i < collisionCount; ++i) {
+            dphysics::Collision *col = object->RigidBody.GetCollision(i);
+            if (col->m_sensor || col->IsGhost()) continue;
+
+            GameObject *other = object->getCollidingObject(col);
+            const bool first = (col->m_body1 == &object->RigidBody);
+
+            ContactEvent event;
+            event.type = (std::find(previous.begin(), previous.end(), other) == previous.end())
+                ? ContactEvent::Type::Begin
+                : ContactEvent::Type::Persist;
+            event.object = object;
+            event.other = other;
+            event.position = col->m_position;
+            event.normal = first ? col->m_normal : ysMath::Negate(col->m_normal);
+            event.closingVelocity = first
+                ? col->GetContactVelocityWorld()
+                : ysMath::Negate(col->GetContactVelocityWorld());
+
+            m_contactEvents.push_back(event);
+            m_contactScratch.push_back(other);
+        }
+
+        previous.swap(m_contactScratch);
+    }
+}
+
+void c_adv::Realm::dispatchContacts() {
+    for (const ContactEvent &event : m_contactEvents) {
+        if (event.object->getDeletionFlag()) continue;
+        event.object->dispatchContact(event);
+    }
+
+    m_contactEvents.clear();
+}
+
+void c_adv::Realm::dispatchDamage() {
+    // Damage handlers can queue more damage
+    for (size_t i = 0; i < m_damageQueue.size(); ++i) {
+        const DamageEvent damage = m_damageQueue[i];
+        if (damage.target->getDeletionFlag()) continue;
+
+        damage.target->onDamage(damage);
+    }
+
+    m_damageQueue.clear();
+}
+
+void c_adv::Realm::discardEvents(GameObject *object) {
+    auto subscriber = std::find(m_contactSubscribers.begin(), m_contactSubscribers.end(), object);
+    if (subscriber != m_contactSubscribers.end()) {
+        *subscriber = m_contactSubscribers.back();
+        m_contactSubscribers.pop_back();
+    }
+
+    m_contactEvents.erase(
+        std::remove_if(m_contactEvents.begin(), m_contactEvents.end(),
+            [object](const ContactEvent &e) { return e.object == object || e.other == object; }),
+        m_contactEvents.end());
+
+    m_damageQueue.erase(
+        std::remove_if(m_damageQueue.begin(), m_damageQueue.end(),
+            [object](const DamageEvent &e) { return e.target == object; }),
+        m_damageQueue.end());
+
+    for (DamageEvent &damage : m_damageQueue) {
+        if (damage.source == object) damage.source = nullptr;
+    }
+}
+
+int c_adv::Realm::computePhysicsSubsteps(float dt) {
+    updateStaticGrid();
+
+    int substeps = m_minPhysicsSubsteps;
+    for (GameObject *g : m_gameObjects) {
+        if (g->RigidBody.GetInverseMass() == 0) continue;
+
+        const ysVector4 v = ysMath::GetVector4(g->RigidBody.GetVelocity());
+        const float travel = std::sqrt(v.x * v.x + v.y * v.y) * dt;
+
+        const AABB &bounds = g->getVisualBounds();
+        const ysVector size = ysMath::Sub(bounds.maxPoint, bounds.minPoint);
+        float thickness = min(ysMath::GetX(size), ysMath::GetY(size));
+
+        // Nothing in the realm is thin enough for this body to tunnel through
+        if (travel <= max(0.5f * min(thickness, m_minStaticThickness), MinCcdFeatureSize)) continue;
+
+        // Otherwise only the statics that the body can reach this step count
+        const ysVector step = ysMath::Mul(g->RigidBody.GetVelocity(), ysMath::LoadScalar(dt));
+        const AABB swept = {
+            ysMath::Add(bounds.minPoint, ysMath::ComponentMin(step, ysMath::Constants::Zero)),
+            ysMath::Add(bounds.maxPoint, ysMath::ComponentMax(step, ysMath::Constants::Zero)) };
+
+        m_substepObstacles.clear();
+        queryStaticObjects(swept, m_substepObstacles);
+
+        for (GameObject *obstacle : m_substepObstacles) {
+            if (obstacle->RigidBody.CollisionGeometry.GetNumObjects() == 0) continue;
+
+            const AABB &obstacleBounds = obstacle->getVisualBounds();
+            const ysVector obstacleSize = ysMath::Sub(obstacleBounds.maxPoint, obstacleBounds.minPoint);
+            thickness = min(thickness, min(ysMath::GetX(obstacleSize), ysMath::GetY(obstacleSize)));
+        }
+
+        const float maxTravel = max(0.5f * thickness, MinCcdFeatureSize);
+        if (travel > maxTravel) {
+            substeps = max(substeps, (int)std::ceil(travel / maxTravel));
+        }
+    }
+
+    return min(substeps, m_maxPhysicsSubsteps);
+}
+
+void c_adv::Realm::setPhysicsSubstepRange(int minSubsteps, int maxSubsteps) {
+    m_maxPhysicsSubsteps = max(min(maxSubsteps, MaxPhysicsSubsteps), 1);
+    m_minPhysicsSubsteps = max(min(minSubsteps, m_maxPhysicsSubsteps), 1);
+}
+
+void c_adv::Realm::updatePhysicsStats() {
+    m_physicsStats.bodies = 0;
+    m_physicsStats.pairs = 0;
+    m_physicsStats.contacts = 0;
+    m_physicsStats.islands = 0;
+
+    const int N = (int)m_gameObjects.size();
+    m_islandParent.resize(N);
+    for (int i = 0; i < N; ++i) {
+        m_islandParent[i] = i;
+    }
+
+    for (int i = 0; i < N; ++i) {
+        GameObject *g = m_gameObjects[i];
+        if (g->RigidBody.GetInverseMass() == 0) continue;
+
+        ++m_physicsStats.bodies;
+        m_pairScratch.clear();
+
+        const int collisionCount = g->RigidBody.GetCollisionCount();
+        for (int j = 0; j < collisionCount; ++j) {
+            dphysics::Collision *col = g->RigidBody.GetCollision(j);
+            GameObject *other = g->getCollidingObject(col);
+
+            // Contacts between two movable bodies are listed on both of them
+            const bool movable = other != nullptr
+                && other->RigidBody.GetInverseMass() != 0
+                && !other->hasTag(GameObject::Tag::Static);
+            if (movable && col->m_body1 != &g->RigidBody) continue;
+
+            ++m_physicsStats.contacts;
+
+            if (std::find(m_pairScratch.begin(), m_pairScratch.end(), other) == m_pairScratch.end()) {
+                m_pairScratch.push_back(other);
+                ++m_physicsStats.pairs;
+            }
+
+            if (movable) {
+                m_islandParent[findIsland(i)] = findIsland(other->getRealmRecordIndex());
+            }
+        }
+    }
+
+    for (int i = 0; i < N; ++i) {
+        if (m_gameObjects[i]->RigidBody.GetInverseMass() == 0) continue;
+        if (findIsland(i) == i) ++m_physicsStats.islands;
+    }
+}
+
+int c_adv::Realm::findIsland(int index) {
+    while (m_islandParent[index] != index) {
+        m_islandParent[index] = m_islandParent[m_islandParent[index]];
+        index = m_islandParent[index];
+    }
+
+    return index;
+}
+
+void c_adv::Realm::queryStaticObjects(const AABB &bounds, std::vector<GameObject *> &objects) {
+    updateStaticGrid();
+
+    m_staticQuery.clear();
+    m_staticGrid.query(bounds, m_staticQuery);
+
+    for (int index : m_staticQuery) {
+        GameObject *object = m_staticObjects[index];
+        if (object->getVisualBounds().intersects2d(bounds)) {
+            objects.push_back(object);
+        }
+    }
+}
+
+const c_adv::BoundsBuffer &c_adv::Realm::getStaticBounds() {
+    updateStaticGrid();
+    return m_staticBounds;
+}
+
+void c_adv::Realm::overlapBox(const AABB &box, std::vector<GameObject *> &objects, GameObject::Tag tag) {
+    const size_t start = objects.size();
+    queryStaticObjects(box, objects);
+
+    m_queryIndices.clear();
+    cullBounds(m_dynamicBounds, box, m_queryIndices);
+
+    for (int index : m_queryIndices) {
+        objects.push_back(m_gameObjects[index]);
+    }
+
+    size_t n = start;
+    for (size_t i = start; i < objects.size(); ++i) {
+        GameObject *object = objects[i];
+        if (object->getDeletionFlag()) continue;
+        if (tag != GameObject::Tag::Count && !object->hasTag(tag)) continue;
+
+        objects[n++] = object;
+    }
+
+    objects.resize(n);
+}
+
+void c_adv::Realm::overlapCircle(
+    const ysVector &center, float radius, std::vector<GameObject *> &objects, GameObject::Tag tag)
+{
+    const ysVector r = ysMath::LoadVector(radius, radius, 0.0f, 0.0f);
+    const AABB box = { ysMath::Sub(center, r), ysMath::Add(center, r) };
+
+    const size_t start = objects.size();
+    overlapBox(box, objects, tag);
+
+    size_t n = start;
+    for (size_t i = start; i < objects.size(); ++i) {
+        if (objects[i]->getVisualBounds().distance2d(center) <= radius) {
+            objects[n++] = objects[i];
+        }
+    }
+
+    objects.resize(n);
+}
+
+c_adv::GameObject *c_adv::Realm::raycast(
+    const ysVector &origin, const ysVector &direction, float maxDistance, float *distance, GameObject::Tag tag)
+{
+    const ysVector end = ysMath::Add(origin, ysMath::Mul(direction, ysMath::LoadScalar(maxDistance)));
+    const AABB box = { ysMath::ComponentMin(origin, end), ysMath::ComponentMax(origin, end) };
+
+    m_queryResults.clear();
+    overlapBox(box, m_queryResults, tag);
+
+    GameObject *closest = nullptr;
+    float closestDistance = maxDistance;
+    for (GameObject *object : m_queryResults) {
+        float t;
+        if (object->getVisualBounds().raycast2d(origin, direction, closestDistance, &t)) {
+            closest = object;
+            closestDistance = t;
+        }
+    }
+
+    if (distance != nullptr) *distance = closestDistance;
+    return closest;
+}
+
+c_adv::GameObject *c_adv::Realm::nearestWithTag(const ysVector &position, float maxDistance, GameObject::Tag tag) {
+    m_queryResults.clear();
+    overlapCircle(position, maxDistance, m_queryResults, tag);
+
+    GameObject *closest = nullptr;
+    float closestDistance = maxDistance;
+    for (GameObject *object : m_queryResults) {
+        const float d = distance(position, object->RigidBody.Transform.GetWorldPosition());
+        if (d <= closestDistance) {
+            closest = object;
+            closestDistance = d;
+        }
+    }
+
+    return closest;
+}
+
+void c_adv::Realm::queryLedges(const ysVector &point, float radius, std::vector<GameObject *> &ledges) {
+    updateLedgeIndex();
+    m_ledgeIndex.query(point, radius, ledges);
+}
+
+void c_adv::Realm::updateLedgeIndex() {
+    if (!m_ledgeIndexDirty) return;
+
+    m_ledgeIndex.clear();
+
+    for (GameObject *g : m_staticObjects) {
+        if (g->hasTag(GameObject::Tag::Ledge)) m_ledgeIndex.add(g);
+    }
+
+    for (GameObject *g : m_gameObjects) {
+        if (g->hasTag(GameObject::Tag::Ledge)) m_ledgeIndex.add(g);
+    }
+
+    m_ledgeIndex.build();
+    m_ledgeIndexDirty = false;
+}
+
+void c_adv::Realm::updateStaticGrid() {
+    if (!m_staticGridDirty) return;
+
+    m_staticGrid.clear();
+    m_staticBounds.clear();
+    m_minStaticThickness = FLT_MAX;
+
+    const int N = (int)m_staticObjects.size();
+    for (int i = 0; i < N; ++i) {
+        GameObject *object = m_staticObjects[i];
+        object->createVisualBounds();
+
+        const AABB &bounds = object->getVisualBounds();
+        m_staticGrid.insert(i, bounds);
+        m_staticBounds.push(bounds);
+
+        if (object->RigidBody.CollisionGeometry.GetNumObjects() > 0) {
+            const ysVector size = ysMath::Sub(bounds.maxPoint, bounds.minPoint);
+            m_minStaticThickness = min(m_minStaticThickness, min(ysMath::GetX(size), ysMath::GetY(size)));
+        }
+    }
+
+    m_staticGridDirty = false;
+}
+
+void c_adv::Realm::sortDynamicObjects() {
+    const int N = (int)m_gameObjects.size();
+
+    m_mortonKeys.resize(N);
+    for (int i = 0; i < N; ++i) {
+        const ysVector position = m_gameObjects[i]->RigidBody.Transform.GetWorldPosition();
+        m_mortonKeys[i] = mortonCode2d(ysMath::GetX(position), ysMath::GetY(position), MortonCellSize);
+    }
+
+    radixSortIndices(m_mortonKeys.data(), N, m_sortOrder, m_sortScratch);
+
+    m_sortedObjects.resize(N);
+    for (int i = 0; i < N; ++i) {
+        m_sortedObjects[i] = m_gameObjects[m_sortOrder[i]];
+        m_sortedObjects[i]->setRealmRecordIndex(i);
+    }
+
+    m_gameObjects.swap(m_sortedObjects);
+    m_dynamicBounds.permute(m_sortOrder);
+}
+
 void c_adv::Realm::initializeFrictionTable() {
     PhysicsSystem.InitializeFrictionTable(10, 0.5f, 0.5f);
 
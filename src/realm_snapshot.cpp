@@ -0,0 +1,14 @@
+#include "../include/realm_snapshot.h"
+
+c_adv::RealmSnapshot::RealmSnapshot() {
+    /* void */
+}
+
+c_adv::RealmSnapshot::~RealmSnapshot() {
+    /* void */
+}
+
+void c_adv::RealmSnapshot::clear() {
+    m_archive.clear();
+    m_records.clear();
+}
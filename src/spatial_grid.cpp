@@ -0,0 +1,94 @@
+#include "../include/spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+c_adv::SpatialGrid::SpatialGrid() {
+    m_currentStamp = 0;
+    m_cellSize = 4.0f;
+}
+
+c_adv::SpatialGrid::~SpatialGrid() {
+    /* void */
+}
+
+void c_adv::SpatialGrid::clear() {
+    m_cells.clear();
+    m_unbounded.clear();
+    m_stamps.clear();
+    m_currentStamp = 0;
+}
+
+void c_adv::SpatialGrid::insert(int id, const AABB &bounds) {
+    if (id >= (int)m_stamps.size()) {
+        m_stamps.resize(id + 1, 0);
+    }
+
+    int x0, y0, x1, y1;
+    if (!getCellRange(bounds, &x0, &y0, &x1, &y1)) {
+        m_unbounded.push_back(id);
+        return;
+    }
+
+    for (int x = x0; x <= x1; ++x) {
+        for (int y = y0; y <= y1; ++y) {
+            m_cells[cellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void c_adv::SpatialGrid::query(const AABB &bounds, std::vector<int> &ids) {
+    int x0, y0, x1, y1;
+    if (!getCellRange(bounds, &x0, &y0, &x1, &y1)) {
+        for (int i = 0; i < (int)m_stamps.size(); ++i) {
+            ids.push_back(i);
+        }
+
+        return;
+    }
+
+    ids.insert(ids.end(), m_unbounded.begin(), m_unbounded.end());
+
+    if (++m_currentStamp == 0) {
+        std::fill(m_stamps.begin(), m_stamps.end(), 0);
+        m_currentStamp = 1;
+    }
+
+    for (int x = x0; x <= x1; ++x) {
+        for (int y = y0; y <= y1; ++y) {
+            auto cell = m_cells.find(cellKey(x, y));
+            if (cell == m_cells.end()) continue;
+
+            for (int id : cell->second) {
+                if (m_stamps[id] == m_currentStamp) continue;
+
+                m_stamps[id] = m_currentStamp;
+                ids.push_back(id);
+            }
+        }
+    }
+}
+
+uint64_t c_adv::SpatialGrid::cellKey(int x, int y) {
+    return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+}
+
+int c_adv::SpatialGrid::cellCoordinate(float v) const {
+    return (int)std::floor(v / m_cellSize);
+}
+
+bool c_adv::SpatialGrid::getCellRange(const AABB &bounds, int *x0, int *y0, int *x1, int *y1) const {
+    const float minX = ysMath::GetX(bounds.minPoint), minY = ysMath::GetY(bounds.minPoint);
+    const float maxX = ysMath::GetX(bounds.maxPoint), maxY = ysMath::GetY(bounds.maxPoint);
+
+    // Bounds that would cover too many cells are kept in a separate list
+    const float maxExtent = m_cellSize * MaxCellSpan;
+    if (maxX - minX > maxExtent || maxY - minY > maxExtent) return false;
+
+    *x0 = cellCoordinate(minX);
+    *y0 = cellCoordinate(minY);
+    *x1 = cellCoordinate(maxX);
+    *y1 = cellCoordinate(maxY);
+
+    return true;
+}
@@ -0,0 +1,108 @@
+#include "../include/spring_system.h"
+
+#include <cstring>
+
+c_adv::SpringSystem::SpringSystem() {
+    m_position = nullptr;
+    m_velocity = nullptr;
+    m_target = nullptr;
+    m_stiffness = nullptr;
+    m_damping = nullptr;
+    m_capacity = 0;
+}
+
+c_adv::SpringSystem::~SpringSystem() {
+    ysVector *arrays[] = { m_position, m_velocity, m_target, m_stiffness, m_damping };
+    for (ysVector *a : arrays) {
+        if (a != nullptr) _aligned_free((void *)a);
+    }
+}
+
+int c_adv::SpringSystem::allocate() {
+    int handle;
+    if (!m_freeList.empty()) {
+        handle = m_freeList.back(); m_freeList.pop_back();
+        m_mode[handle] = Mode::Explicit;
+    }
+    else {
+        handle = (int)m_mode.size();
+        if (handle >= m_capacity) {
+            reserve((m_capacity == 0) ? 64 : m_capacity * 2);
+        }
+
+        m_mode.push_back(Mode::Explicit);
+    }
+
+    m_position[handle] = ysMath::Constants::Zero;
+    m_velocity[handle] = ysMath::Constants::Zero;
+    m_target[handle] = ysMath::Constants::Zero;
+    m_stiffness[handle] = ysMath::Constants::Zero;
+    m_damping[handle] = ysMath::Constants::Zero;
+
+    return handle;
+}
+
+void c_adv::SpringSystem::release(int handle) {
+    // A spring with no stiffness and no velocity stays where it is, so free
+    // slots can be integrated along with the rest without any checks
+    m_velocity[handle] = ysMath::Constants::Zero;
+    m_stiffness[handle] = ysMath::Constants::Zero;
+    m_mode[handle] = Mode::Explicit;
+
+    m_freeList.push_back(handle);
+}
+
+void c_adv::SpringSystem::update(float dt) {
+    const int N = (int)m_mode.size();
+    const ysVector dt_v = ysMath::LoadScalar(dt);
+
+    for (int i = 0; i < N; ++i) {
+        const ysVector x0 = ysMath::Sub(m_position[i], m_target[i]);
+        const ysVector v0 = m_velocity[i];
+
+        if (m_mode[i] == Mode::Explicit) {
+            const ysVector a = ysMath::Mul(ysMath::Negate(x0), m_stiffness[i]);
+            const ysVector v = ysMath::Add(v0, ysMath::Mul(dt_v, a));
+
+            m_position[i] = ysMath::Add(m_position[i], ysMath::Mul(dt_v, v));
+            m_velocity[i] = ysMath::Mul(v, ysMath::Sub(ysMath::Constants::One, m_damping[i]));
+        }
+        else {
+            // x(t) = (x0 + (v0 + w * x0) * t) * exp(-w * t) with w = sqrt(k).
+            // exp(-u) uses a rational approximation that stays in (0, 1].
+            const ysVector w = ysMath::Sqrt(m_stiffness[i]);
+            const ysVector u = ysMath::Mul(w, dt_v);
+            const ysVector u2 = ysMath::Mul(u, u);
+            const ysVector u3 = ysMath::Mul(u2, u);
+            const ysVector e = ysMath::Div(
+                ysMath::Constants::One,
+                ysMath::Add(
+                    ysMath::Add(ysMath::Constants::One, u),
+                    ysMath::Add(
+                        ysMath::Mul(ysMath::LoadScalar(0.48f), u2),
+                        ysMath::Mul(ysMath::LoadScalar(0.235f), u3))));
+
+            const ysVector c = ysMath::Mul(ysMath::Add(v0, ysMath::Mul(w, x0)), dt_v);
+
+            m_velocity[i] = ysMath::Mul(ysMath::Sub(v0, ysMath::Mul(w, c)), e);
+            m_position[i] = ysMath::Add(m_target[i], ysMath::Mul(ysMath::Add(x0, c), e));
+        }
+    }
+}
+
+void c_adv::SpringSystem::reserve(int capacity) {
+    ysVector **arrays[] = { &m_position, &m_velocity, &m_target, &m_stiffness, &m_damping };
+    const int size = (int)m_mode.size();
+
+    for (ysVector **a : arrays) {
+        ysVector *buffer = (ysVector *)_aligned_malloc(sizeof(ysVector) * capacity, 16);
+        if (*a != nullptr) {
+            memcpy((void *)buffer, (void *)*a, sizeof(ysVector) * size);
+            _aligned_free((void *)*a);
+        }
+
+        *a = buffer;
+    }
+
+    m_capacity = capacity;
+}
@@ -0,0 +1,24 @@
+#include "../include/state_archive.h"
+
+c_adv::StateArchive::StateArchive() {
+    m_readOffset = 0;
+}
+
+c_adv::StateArchive::~StateArchive() {
+    /* void */
+}
+
+void c_adv::StateArchive::writeVector(const ysVector &v) {
+    write(ysMath::GetVector4(v));
+}
+
+ysVector c_adv::StateArchive::readVector() {
+    const ysVector4 v = read<ysVector4>();
+    return ysMath::LoadVector(v.x, v.y, v.z, v.w);
+}
+
+void c_adv::StateArchive::clear() {
+    // Swap with an empty buffer so that the memory is actually released
+    std::vector<unsigned char>().swap(m_data);
+    m_readOffset = 0;
+}
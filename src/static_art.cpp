@@ -14,10 +14,24 @@ c_adv::StaticArt::~StaticArt() {
 void c_adv::StaticArt::initialize() {
     GameObject::initialize();
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    addTag(Tag::Static);
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
 }
 
+void c_adv::StaticArt::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_asset);
+}
+
+void c_adv::StaticArt::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_asset = archive.read<dbasic::ModelAsset *>();
+}
+
 void c_adv::StaticArt::render() {
     m_world->getShaders().SetObjectTransform(RigidBody.Transform.GetWorldTransform());
     m_world->getShaders().ConfigureModel(1.0f, m_asset);
@@ -22,16 +22,14 @@ void c_adv::StoveHood::initialize() {
 
     RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
     RigidBody.SetInverseMass(0.0f);
-    RigidBody.SetAlwaysAwake(true);
-    RigidBody.SetRequestsInformation(true);
+    RigidBody.SetAlwaysAwake(false);
+    RigidBody.SetRequestsInformation(false);
 
-    dphysics::CollisionObject *bounds;
-    RigidBody.CollisionGeometry.NewCircleObject(&bounds);
-    bounds->SetMode(dphysics::CollisionObject::Mode::Sensor);
-    bounds->GetAsCircle()->Radius = 4.0f;
-    bounds->GetAsCircle()->Position = ysMath::Constants::Zero;
-    bounds->SetRelativePosition(ysMath::LoadVector(0.0f, -10.0f, 0.0f));
+    setWakeRegion({
+        ysMath::LoadVector(-2.5f, -15.0f, 0.0f, 0.0f),
+        ysMath::LoadVector(2.5f, 31.0f, 0.0f, 0.0f) });
 
+    dphysics::CollisionObject *bounds;
     RigidBody.CollisionGeometry.NewBoxObject(&bounds);
     bounds->SetMode(dphysics::CollisionObject::Mode::Fine);
     bounds->GetAsBox()->HalfWidth = 1.0f;
@@ -64,25 +62,26 @@ void c_adv::StoveHood::process(float dt) {
         m_currentPower = max(m_currentPower, 0.0f);
     }
 
-    const int collisionCount = RigidBody.GetCollisionCount();
-    for (int i = 0; i < collisionCount; ++i) {
-        dphysics::Collision *col = RigidBody.GetCollision(i);
-
-        if (col->m_sensor) {
-            GameObject *obj = getCollidingObject(col);
-
-            float obj_x = ysMath::GetX(obj->RigidBody.Transform.GetWorldPosition());
-            float hood_x = ysMath::GetX(RigidBody.Transform.GetWorldPosition());
-
-            if (std::abs(obj_x - hood_x) < 1.5f) {
-                if (!obj->hasTag(GameObject::Tag::Dynamic)) continue;
-                if (ysMath::GetY(obj->RigidBody.GetVelocity()) > 7.5f) continue;
-
-                obj->RigidBody.AddForceLocalSpace(
-                    ysMath::LoadVector(0.0f, m_currentPower, 0.0f), ysMath::Constants::Zero);
-            }
-        }
-    }
+    // The field draws upward along the hood's local y axis
+    const ysVector center = RigidBody.Transform.LocalToWorldSpace(ysMath::LoadVector(0.0f, -10.0f, 0.0f));
+    const ysVector4 axis = ysMath::GetVector4(RigidBody.Transform.LocalToWorldDirection(ysMath::Constants::XAxis));
+    const ysVector4 up = ysMath::GetVector4(RigidBody.Transform.LocalToWorldDirection(ysMath::Constants::YAxis));
+
+    ForceField field;
+    field.shape = ForceField::Shape::Box;
+    field.x = ysMath::GetX(center);
+    field.y = ysMath::GetY(center);
+    field.axisX = axis.x;
+    field.axisY = axis.y;
+    field.halfWidth = 1.5f;
+    field.halfHeight = 4.0f;
+    field.directionX = up.x;
+    field.directionY = up.y;
+    field.forceX = m_currentPower * up.x;
+    field.forceY = m_currentPower * up.y;
+    field.maxVelocity = 7.5f;
+
+    m_realm->getForceFields().setField(this, field);
 }
 
 void c_adv::StoveHood::getAssets(dbasic::AssetManager *am) {
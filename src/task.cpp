@@ -0,0 +1,88 @@
+#include "../include/task.h"
+
+#include "../include/game_object.h"
+#include "../include/realm.h"
+
+c_adv::Task::Task() {
+    m_owner = nullptr;
+    m_line = Done;
+
+    m_timer = TimerWheel::InvalidTimer;
+}
+
+c_adv::Task::~Task() {
+    /* void */
+}
+
+void c_adv::Task::initialize(GameObject *owner, const Body &body) {
+    m_owner = owner;
+    m_body = body;
+}
+
+void c_adv::Task::start() {
+    cancelWait();
+
+    m_line = 0;
+    resume();
+}
+
+void c_adv::Task::stop() {
+    cancelWait();
+    m_line = Done;
+}
+
+void c_adv::Task::resume() {
+    m_timer = TimerWheel::InvalidTimer;
+
+    if (m_line != Done) m_body(*this);
+}
+
+void c_adv::Task::wait(float delay, int line) {
+    m_line = line;
+
+    m_timer = getWheel()->schedule(m_owner, delay, [this]() { resume(); });
+}
+
+void c_adv::Task::finish() {
+    m_line = Done;
+}
+
+bool c_adv::Task::isWaiting() const {
+    if (m_timer == TimerWheel::InvalidTimer) return false;
+
+    TimerWheel *wheel = getWheel();
+    return wheel != nullptr && wheel->isScheduled(m_timer);
+}
+
+float c_adv::Task::getRemaining() const {
+    return isWaiting() ? getWheel()->getRemaining(m_timer) : 0.0f;
+}
+
+void c_adv::Task::saveState(StateArchive &archive) const {
+    const bool waiting = isWaiting();
+    archive.write(waiting ? m_line : (int)Done);
+    archive.write(waiting ? getWheel()->getRemaining(m_timer) : -1.0f);
+}
+
+void c_adv::Task::loadState(StateArchive &archive) {
+    cancelWait();
+
+    const int line = archive.read<int>();
+    const float remaining = archive.read<float>();
+
+    m_line = line;
+    if (remaining >= 0.0f) wait(remaining, line);
+}
+
+void c_adv::Task::cancelWait() {
+    TimerWheel *wheel = getWheel();
+    if (wheel != nullptr && m_timer != TimerWheel::InvalidTimer) wheel->cancel(m_timer);
+
+    m_timer = TimerWheel::InvalidTimer;
+}
+
+c_adv::TimerWheel *c_adv::Task::getWheel() const {
+    // Timer ids are unique across wheels and follow the owner between realms
+    Realm *realm = (m_owner != nullptr) ? m_owner->getRealm() : nullptr;
+    return (realm != nullptr) ? &realm->getTimers() : nullptr;
+}
@@ -0,0 +1,156 @@
+#include "../include/timer_wheel.h"
+
+#include <cmath>
+
+c_adv::TimerWheel::TimerId c_adv::TimerWheel::s_nextId = c_adv::TimerWheel::InvalidTimer + 1;
+
+c_adv::TimerWheel::TimerWheel() {
+    m_currentTick = 0;
+    m_accumulator = 0.0f;
+    m_tickLength = 1 / 100.0f;
+}
+
+c_adv::TimerWheel::~TimerWheel() {
+    /* void */
+}
+
+c_adv::TimerWheel::TimerId c_adv::TimerWheel::schedule(GameObject *owner, float delay, const Callback &callback) {
+    if (s_nextId == InvalidTimer) ++s_nextId;
+    const TimerId id = s_nextId++;
+
+    // Round up so that a timer never fires before its delay has elapsed
+    const uint64_t ticks = (uint64_t)std::ceil(std::fmax(delay, 0.0f) / m_tickLength);
+
+    Timer timer;
+    timer.id = id;
+    timer.deadline = m_currentTick + ((ticks > 0) ? ticks : 1);
+    timer.callback = callback;
+
+    m_owners[id] = { owner, timer.deadline };
+    insert(std::move(timer));
+
+    return id;
+}
+
+void c_adv::TimerWheel::cancel(TimerId timer) {
+    // Cancelled timers stay in their slot and are dropped when they come due
+    m_owners.erase(timer);
+}
+
+void c_adv::TimerWheel::cancelAll(GameObject *owner) {
+    for (auto it = m_owners.begin(); it != m_owners.end();) {
+        if (it->second.object == owner) it = m_owners.erase(it);
+        else ++it;
+    }
+}
+
+void c_adv::TimerWheel::moveAll(GameObject *owner, TimerWheel *destination) {
+    for (int level = 0; level < Levels; ++level) {
+        for (int slot = 0; slot < Slots; ++slot) {
+            std::vector<Timer> &timers = m_slots[level][slot];
+
+            size_t kept = 0;
+            for (size_t i = 0; i < timers.size(); ++i) {
+                auto it = m_owners.find(timers[i].id);
+                if (it == m_owners.end() || it->second.object != owner) {
+                    if (kept != i) timers[kept] = std::move(timers[i]);
+                    ++kept;
+                    continue;
+                }
+
+                // The remaining delay carries over in whole ticks
+                Timer timer = std::move(timers[i]);
+                timer.deadline = destination->m_currentTick + (timer.deadline - m_currentTick);
+                m_owners.erase(it);
+
+                destination->m_owners[timer.id] = { owner, timer.deadline };
+                destination->insert(std::move(timer));
+            }
+
+            timers.resize(kept);
+        }
+    }
+}
+
+void c_adv::TimerWheel::clear() {
+    for (int level = 0; level < Levels; ++level) {
+        for (int slot = 0; slot < Slots; ++slot) {
+            m_slots[level][slot].clear();
+        }
+    }
+
+    m_owners.clear();
+}
+
+float c_adv::TimerWheel::getRemaining(TimerId timer) const {
+    auto it = m_owners.find(timer);
+    if (it == m_owners.end()) return 0.0f;
+
+    const float remaining = (it->second.deadline - m_currentTick) * m_tickLength - m_accumulator;
+    return (remaining > 0.0f) ? remaining : 0.0f;
+}
+
+void c_adv::TimerWheel::advance(float dt) {
+    m_accumulator += dt;
+
+    while (m_accumulator >= m_tickLength) {
+        m_accumulator -= m_tickLength;
+        tick();
+    }
+}
+
+void c_adv::TimerWheel::insert(Timer &&timer) {
+    const uint64_t delta = timer.deadline - m_currentTick;
+
+    int level = 0;
+    while (level < Levels - 1 && delta >= ((uint64_t)1 << (SlotBits * (level + 1)))) {
+        ++level;
+    }
+
+    // Timers past the range of the top level wait in its furthest slot and
+    // are cascaded again until they are in range
+    const uint64_t maxDeadline = m_currentTick + ((uint64_t)1 << (SlotBits * Levels)) - 1;
+    const uint64_t deadline = (timer.deadline < maxDeadline) ? timer.deadline : maxDeadline;
+
+    const int slot = (int)((deadline >> (SlotBits * level)) & (Slots - 1));
+    m_slots[level][slot].push_back(std::move(timer));
+}
+
+void c_adv::TimerWheel::cascade(int level) {
+    const int slot = (int)((m_currentTick >> (SlotBits * level)) & (Slots - 1));
+
+    std::vector<Timer> timers;
+    timers.swap(m_slots[level][slot]);
+
+    for (Timer &timer : timers) {
+        if (m_owners.count(timer.id) == 0) continue;
+        insert(std::move(timer));
+    }
+}
+
+void c_adv::TimerWheel::tick() {
+    ++m_currentTick;
+
+    // Higher levels are cascaded first since they can move timers into the
+    // lower level slots that are due now
+    int topLevel = 0;
+    while (topLevel < Levels - 1 && (m_currentTick & (((uint64_t)1 << (SlotBits * (topLevel + 1))) - 1)) == 0) {
+        ++topLevel;
+    }
+
+    for (int level = topLevel; level >= 1; --level) {
+        cascade(level);
+    }
+
+    const int slot = (int)(m_currentTick & (Slots - 1));
+
+    m_due.clear();
+    m_due.swap(m_slots[0][slot]);
+
+    for (Timer &timer : m_due) {
+        if (m_owners.erase(timer.id) == 0) continue;
+        timer.callback();
+    }
+
+    m_due.clear();
+}
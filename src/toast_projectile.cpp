@@ -8,7 +8,6 @@ dbasic::ModelAsset *c_adv::ToastProjectile::m_toastAsset = nullptr;
 c_adv::ToastProjectile::ToastProjectile() {
     m_age = 0.0f;
     m_lifespan = 3.0f;
-    m_timeAsGhost = 0.1f;
     m_dangerous = true;
 }
 
@@ -33,21 +32,37 @@ void c_adv::ToastProjectile::initialize() {
     bounds->SetMode(dphysics::CollisionObject::Mode::Fine);
     bounds->GetAsBox()->HalfHeight = 0.442f / 2;
     bounds->GetAsBox()->HalfWidth = 0.07f / 2;
-    bounds->SetLayer(ProjectileCollisionLayer);
-    bounds->SetCollidesWith(EmitterCollisionLayer, false);
-
-    m_collisionPrimitive = bounds;
+    setCollisionLayer(Layer::Projectile);
 
     m_positionDamper.setDampingTensor(ysMath::LoadVector(0.5f, 0.5f, 0.0f));
     m_positionDamper.setStiffnessTensor(ysMath::LoadVector(500.0f, 500.0f, 0.0f));
     m_positionDamper.setPosition(RigidBody.Transform.GetWorldPosition());
+    m_positionDamper.setMode(SpringConnector::Mode::CriticallyDamped);
 
     m_rotationDamper.setDampingTensor(ysMath::LoadScalar(0.5f));
     m_rotationDamper.setStiffnessTensor(ysMath::LoadScalar(1000.0f));
     m_rotationDamper.setPosition(RigidBody.Transform.GetWorldOrientation());
+    m_rotationDamper.setMode(SpringConnector::Mode::CriticallyDamped);
+}
+
+void c_adv::ToastProjectile::saveState(StateArchive &archive) {
+    GameObject::saveState(archive);
+
+    archive.write(m_age);
+    archive.write(m_dangerous);
+}
+
+void c_adv::ToastProjectile::loadState(StateArchive &archive) {
+    GameObject::loadState(archive);
+
+    m_age = archive.read<float>();
+    m_dangerous = archive.read<bool>();
 }
 
 void c_adv::ToastProjectile::render() {
+    m_renderTransform.SetPosition(m_positionDamper.getPosition());
+    m_renderTransform.SetOrientation(m_rotationDamper.getPosition());
+
     m_world->getShaders().ResetBrdfParameters();
     m_world->getShaders().SetBaseColor(DebugRed);
 
@@ -60,20 +75,13 @@ void c_adv::ToastProjectile::process(float dt) {
     GameObject::process(dt);
 
     m_positionDamper.setTarget(RigidBody.Transform.GetWorldPosition());
-    m_positionDamper.update(dt);
-
     m_rotationDamper.setTarget(RigidBody.Transform.GetWorldOrientation());
-    m_rotationDamper.update(dt);
-
-    m_renderTransform.SetPosition(m_positionDamper.getPosition());
-    m_renderTransform.SetOrientation(m_rotationDamper.getPosition());
 
     RigidBody.AddForceWorldSpace(
         ysMath::LoadVector(0.0f, -15.0f / RigidBody.GetInverseMass(), 0.0f),
         RigidBody.Transform.GetWorldPosition());
 
     m_age += dt;
-    m_collisionPrimitive->SetCollidesWith(EmitterCollisionLayer, m_age > m_timeAsGhost);
 
     checkDespawn();
 }
@@ -2,10 +2,10 @@
 
 #include "../include/world.h"
 #include "../include/colors.h"
-#include "../include/toast_projectile.h"
 
 dbasic::ModelAsset *c_adv::Toaster::m_toasterAsset = nullptr;
 dbasic::AudioAsset *c_adv::Toaster::m_launchAudio = nullptr;
+dbasic::ModelAsset *c_adv::Toaster::m_toastAsset = nullptr;
 
 const float c_adv::Toaster::ToastSpread = 0.03f;
 
@@ -30,15 +30,10 @@ void c_adv::Toaster::initialize() {
     bounds->GetAsBox()->HalfWidth = 0.56f / 2;
     bounds->GetAsBox()->Orientation = ysMath::Constants::QuatIdentity;
     bounds->GetAsBox()->Position = ysMath::Constants::Zero;
-    bounds->SetLayer(EmitterCollisionLayer);
-    bounds->SetCollidesWith(ProjectileCollisionLayer, false);
+    setCollisionLayer(Layer::Emitter);
 
-    m_clock.setHighTime(1.0f);
-    m_clock.setLowTime(10.0f);
-    m_clock.setEnabled(false);
-
-    m_warmupTimer.setCooldownPeriod(ysMath::UniformRandom() * 3.0f);
-    m_warmupTimer.trigger();
+    m_fireLoop.initialize(this, [this](Task &task) { fireLoop(task); });
+    m_fireLoop.start();
 }
 
 void c_adv::Toaster::render() {
@@ -50,37 +45,43 @@ void c_adv::Toaster::render() {
     m_world->getEngine().DrawModel(m_world->getShaders().GetRegularFlags(), m_toasterAsset);
 }
 
-void c_adv::Toaster::process(float dt) {
-    m_clock.update(dt);
-    m_warmupTimer.update(dt);
-
-    if (m_warmupTimer.ready()) {
-        m_clock.setEnabled(true);
-    }
-
-    if (m_clock.getState()) {
-        m_world->getEngine().PlayAudio(m_launchAudio);
+void c_adv::Toaster::fireLoop(Task &task) {
+    TASK_BEGIN(task);
 
-        ToastProjectile *projectile = getRealm()->spawn<ToastProjectile>();
-        projectile->RigidBody.Transform.SetPosition(
-            ysMath::Add(RigidBody.Transform.GetWorldPosition(), ysMath::LoadVector(0.1f, 0.0f, 0.0f))
-        );
+    // Toasters warm up for a random time so they don't fire in sync
+    TASK_WAIT(task, ysMath::UniformRandom() * MaxWarmup + FirePeriod);
 
-        const float angle = ToastSpread * (0.5f - ysMath::UniformRandom()) * ysMath::Constants::PI + ysMath::Constants::PI / 2;
-        const float velocity = ysMath::UniformRandom() * 10.0f + 5.0f;
-        const float angularVelocity = (0.5f - ysMath::UniformRandom()) * 5.0f;
+    while (true) {
+        fire();
+        TASK_WAIT(task, FirePeriod);
+    }
 
-        projectile->RigidBody.SetVelocity(
-            ysMath::LoadVector(cos(angle) * velocity, sin(angle) * velocity, 0.0f));
-        projectile->RigidBody.SetAngularVelocity(
-            ysMath::LoadVector(0.0f, 0.0f, angularVelocity)
-        );
+    TASK_END(task);
+}
 
-        m_clock.reset();
-    }
+void c_adv::Toaster::fire() {
+    const ysVector position = RigidBody.Transform.GetWorldPosition();
+    m_world->getAudio().play(m_launchAudio, AudioGroup::Emitter, 0, position);
+
+    const float angle = ToastSpread * (0.5f - ysMath::UniformRandom()) * ysMath::Constants::PI + ysMath::Constants::PI / 2;
+    const float velocity = ysMath::UniformRandom() * 10.0f + 5.0f;
+
+    Projectile toast;
+    toast.x = ysMath::GetX(position) + 0.1f;
+    toast.y = ysMath::GetY(position);
+    toast.velocityX = cos(angle) * velocity;
+    toast.velocityY = sin(angle) * velocity;
+    toast.angularVelocity = (0.5f - ysMath::UniformRandom()) * 5.0f;
+    toast.radius = ToastRadius;
+    toast.lifespan = 3.0f;
+    toast.bounce = true;
+    toast.model = m_toastAsset;
+    toast.color = &DebugRed;
+    m_realm->getProjectiles().emit(toast);
 }
 
 void c_adv::Toaster::getAssets(dbasic::AssetManager *am) {
     m_toasterAsset = am->GetModelAsset("Toaster");
     m_launchAudio = am->GetAudioAsset("Toaster::Launch");
+    m_toastAsset = am->GetModelAsset("Toast");
 }
@@ -48,10 +48,8 @@ void c_adv::TurnTableCamera::process(float dt) {
     cameraPosition = ysMath::MatMult(tt_rot, cameraPosition);
 
     m_smoothPosition.setTarget(cameraPosition);
-    m_smoothPosition.update(dt);
 
     m_smoothTarget.setTarget(ysMath::LoadVector(0.0f, 0.0f, m_targetHeight));
-    m_smoothTarget.update(dt);
 
     if (m_world->getEngine().IsKeyDown(ysKey::Code::Left)) {
         m_turnTableAngle -= 1.0f * dt;
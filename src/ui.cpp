@@ -58,7 +58,6 @@ void c_adv::Ui::render() {
 
 void c_adv::Ui::process(float dt) {
     m_damageTimer.update(dt);
-    m_healthHeartbeat.update(dt);
 
     m_healthHeartbeat.adjustPeriod(m_playerHealth + 3.0f);
 }
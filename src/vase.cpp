@@ -31,13 +31,18 @@ void c_adv::Vase::initialize() {
     m_positionDamper.setDampingTensor(ysMath::LoadVector(0.5f, 0.5f, 0.0f));
     m_positionDamper.setStiffnessTensor(ysMath::LoadVector(500.0f, 500.0f, 0.0f));
     m_positionDamper.setPosition(RigidBody.Transform.GetWorldPosition());
+    m_positionDamper.setMode(SpringConnector::Mode::CriticallyDamped);
 
     m_rotationDamper.setDampingTensor(ysMath::LoadScalar(0.5f));
     m_rotationDamper.setStiffnessTensor(ysMath::LoadScalar(1000.0f));
     m_rotationDamper.setPosition(RigidBody.Transform.GetWorldOrientation());
+    m_rotationDamper.setMode(SpringConnector::Mode::CriticallyDamped);
 }
 
 void c_adv::Vase::render() {
+    m_renderTransform.SetPosition(m_positionDamper.getPosition());
+    m_renderTransform.SetOrientation(m_rotationDamper.getPosition());
+
     m_world->getShaders().ResetBrdfParameters();
     m_world->getShaders().SetBaseColor(DebugRed);
 
@@ -50,13 +55,7 @@ void c_adv::Vase::process(float dt) {
     GameObject::process(dt);
 
     m_positionDamper.setTarget(RigidBody.Transform.GetWorldPosition());
-    m_positionDamper.update(dt);
-
     m_rotationDamper.setTarget(RigidBody.Transform.GetWorldOrientation());
-    m_rotationDamper.update(dt);
-
-    m_renderTransform.SetPosition(m_positionDamper.getPosition());
-    m_renderTransform.SetOrientation(m_rotationDamper.getPosition());
 
     RigidBody.AddForceWorldSpace(
         ysMath::LoadVector(0.0f, -15.0f / RigidBody.GetInverseMass(), 0.0f),
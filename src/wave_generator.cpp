@@ -1,22 +1,18 @@
 #include "../include/wave_generator.h"
 
-#include "../include/delta.h"
-
-#include <cmath>
-
 c_adv::WaveGenerator::WaveGenerator() {
-    m_timer = 0;
-    m_f = 0;
-    m_period = 0;
+    m_handle = getPool().allocate();
 }
 
 c_adv::WaveGenerator::~WaveGenerator() {
-    /* void */
+    getPool().release(m_handle);
 }
 
-void c_adv::WaveGenerator::update(float dt) {
-    m_timer += dt;
-    while (m_timer > m_period) m_timer -= m_period;
+void c_adv::WaveGenerator::updateAll(float dt) {
+    getPool().update(dt);
+}
 
-    m_f = std::sin((m_timer / m_period) * ysMath::Constants::TWO_PI);
+c_adv::PhasePool &c_adv::WaveGenerator::getPool() {
+    static PhasePool pool(true);
+    return pool;
 }
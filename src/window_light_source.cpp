@@ -14,7 +14,9 @@ c_adv::WindowLightSource::~WindowLightSource() {
 void c_adv::WindowLightSource::initialize() {
     GameObject::initialize();
 
-    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Dynamic);
+    addTag(Tag::Static);
+
+    RigidBody.SetHint(dphysics::RigidBody::RigidBodyHint::Static);
     RigidBody.SetInverseMass(0.0f);
 }
 
@@ -3,7 +3,10 @@
 #include "../include/asset_loader.h"
 #include "../include/realm.h"
 #include "../include/player.h"
+#include "../include/spring_connector.h"
 #include "../include/test_obstacle.h"
+#include "../include/wave_generator.h"
+#include "../include/wrapping_timer.h"
 #include "../include/game_objects.h"
 
 #include <map>
@@ -18,6 +21,9 @@ c_adv::World::World() {
     m_intermediateRenderTarget = nullptr;
     m_uiStageFlags = 0x0;
     m_demo = false;
+
+    m_realmHibernationDelay = 30.0f;
+    m_maxTimestep = 1 / 30.0f;
 }
 
 c_adv::World::~World() {
@@ -116,6 +122,10 @@ void c_adv::World::initialize(void *instance, ysContextObject::DeviceAPI api) {
 
     m_shaders.SetFarClip(200.0f);
     m_ui.setWorld(this);
+
+    const int hardwareThreads = (int)std::thread::hardware_concurrency();
+    m_jobSystem.initialize(max(hardwareThreads - 1, 1));
+    m_audio.initialize(&m_engine, true);
 }
 
 void c_adv::World::initialSpawn() {
@@ -202,19 +212,66 @@ void c_adv::World::render() {
 }
 
 void c_adv::World::process() {
-    // Limit min framerate to 30 fps
-    const float dt = min(1 / 30.0f, getEngine().GetFrameLength());
+    // Fast bodies are substepped by each realm, so the cap only bounds
+    // the amount of work done in a single frame
+    const float dt = min(m_maxTimestep, getEngine().GetFrameLength());
+
+    WaveGenerator::updateAll(dt);
+    WrappingTimer::updateAll(dt);
+
+    for (Realm *realm : m_realms) {
+        if (realm->isHibernating()) continue;
+        realm->process(dt);
+    }
+
+    SpringConnector::updateAll(dt);
+
+    updatePhysics(dt);
+    updateRealms();
+    updateHibernation(dt);
 
-    m_mainRealm->process(dt);
+    if (m_engine.ProcessKeyDown(ysKey::Code::F11)) {
+        captureCheckpoint();
+    }
+    else if (m_engine.ProcessKeyDown(ysKey::Code::F12)) {
+        restoreCheckpoint();
+    }
 
+    // The player is revived in place rather than rebuilt from scratch
     if (m_focus != nullptr && m_focus->isDead()) {
-        m_focus->decrementReferenceCount();
-        m_focus = m_mainRealm->spawn<Player>();
+        m_focus->getRealm()->revive(m_focus);
         m_focus->RigidBody.Transform.SetPosition(m_respawnPosition);
-        m_focus->incrementReferenceCount();
+
+        if (m_focus->getRealm() != m_mainRealm) {
+            m_focus->changeRealm(m_mainRealm);
+        }
     }
 
     m_ui.process(dt);
+
+    const AABB camera = getCameraExtents();
+    m_audio.update(
+        dt,
+        0.5f * (ysMath::GetX(camera.minPoint) + ysMath::GetX(camera.maxPoint)),
+        0.5f * (ysMath::GetY(camera.minPoint) + ysMath::GetY(camera.maxPoint)));
+}
+
+c_adv::GameObject *c_adv::World::findObject(unsigned int objectId) const {
+    for (Realm *realm : m_realms) {
+        GameObject *object = realm->findObject(objectId);
+        if (object != nullptr) return object;
+    }
+
+    return nullptr;
+}
+
+void c_adv::World::captureCheckpoint() {
+    m_mainRealm->captureSnapshot(m_checkpoint);
+}
+
+void c_adv::World::restoreCheckpoint() {
+    if (m_checkpoint.isEmpty()) return;
+    m_mainRealm->restoreSnapshot(m_checkpoint);
 }
 
 void c_adv::World::generateLevel(dbasic::RenderSkeleton *hierarchy) {
@@ -367,6 +424,11 @@ void c_adv::World::generateLevel(dbasic::RenderSkeleton *hierarchy) {
                 Table *table = m_mainRealm->spawn<Table>();
                 table->RigidBody.Transform.SetPosition(position);
             }
+            else if (strcmp(instance->GetName(), "MobSpawner") == 0) {
+                ysVector position = node->Transform.GetWorldPosition();
+                MobSpawner *spawner = m_mainRealm->spawn<MobSpawner>();
+                spawner->RigidBody.Transform.SetPosition(position);
+            }
             else {
                 branchTerminate = false;
             }
@@ -408,8 +470,37 @@ void c_adv::World::renderUi() {
     m_ui.render();
 }
 
+void c_adv::World::updatePhysics(float dt) {
+    m_engine.GetBreakdownTimer().StartMeasurement(PhysicsTimer);
+    {
+        // Each realm owns its own rigid body system so they can be stepped
+        // independently. Realm transfers are only applied once all of them
+        // have finished.
+        for (Realm *realm : m_realms) {
+            if (realm->isHibernating()) continue;
+            m_jobSystem.kick([realm, dt]() { realm->updatePhysics(dt); });
+        }
+
+        m_jobSystem.wait();
+    }
+    m_engine.GetBreakdownTimer().EndMeasurement(PhysicsTimer);
+}
+
 void c_adv::World::updateRealms() {
     for (Realm *realm : m_realms) {
         realm->updateRealms();
     }
 }
+
+void c_adv::World::updateHibernation(float dt) {
+    Realm *focusRealm = (m_focus != nullptr) ? m_focus->getRealm() : m_mainRealm;
+
+    for (Realm *realm : m_realms) {
+        if (realm == m_mainRealm || realm->isHibernating()) continue;
+
+        realm->updatePresence(realm == focusRealm, dt);
+        if (realm->getIdleTime() >= m_realmHibernationDelay && realm->canHibernate()) {
+            realm->hibernate();
+        }
+    }
+}
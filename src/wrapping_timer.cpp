@@ -1,22 +1,18 @@
 #include "../include/wrapping_timer.h"
 
 c_adv::WrappingTimer::WrappingTimer() {
-    m_timer = 0;
-    m_period = 0;
+    m_handle = getPool().allocate();
 }
 
 c_adv::WrappingTimer::~WrappingTimer() {
-    /* void */
+    getPool().release(m_handle);
 }
 
-void c_adv::WrappingTimer::update(float dt) {
-    m_timer += dt;
-    while (m_timer > m_period) m_timer -= m_period;
+void c_adv::WrappingTimer::updateAll(float dt) {
+    getPool().update(dt);
 }
 
-void c_adv::WrappingTimer::adjustPeriod(float period) {
-    const float s = get();
-
-    m_period = period;
-    m_timer = s * m_period;
+c_adv::PhasePool &c_adv::WrappingTimer::getPool() {
+    static PhasePool pool(false);
+    return pool;
 }
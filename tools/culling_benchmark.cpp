@@ -0,0 +1,63 @@
+#include "../include/culling.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+// Times the vectorized and scalar culling paths against random boxes at 1k,
+// 10k and 100k objects
+int main() {
+    typedef std::chrono::high_resolution_clock Clock;
+
+    const int Sizes[] = { 1000, 10000, 100000 };
+    const int Iterations = 200;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+
+    const c_adv::AABB extents = {
+        ysMath::LoadVector(-40.0f, -25.0f, 0.0f, 1.0f),
+        ysMath::LoadVector(40.0f, 25.0f, 0.0f, 1.0f) };
+
+    std::cout << "Culling (" << c_adv::getCullingPathName(c_adv::getCullingPath()) << " vs Scalar)\n";
+
+    bool mismatch = false;
+    for (int n : Sizes) {
+        c_adv::BoundsBuffer bounds;
+        for (int i = 0; i < n; ++i) {
+            const float x = position(rng), y = position(rng);
+            bounds.push({
+                ysMath::LoadVector(x, y, 0.0f, 1.0f),
+                ysMath::LoadVector(x + size(rng), y + size(rng), 0.0f, 1.0f) });
+        }
+
+        std::vector<int> visible;
+        visible.reserve(n);
+
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < Iterations; ++i) {
+            visible.clear();
+            c_adv::cullBounds(bounds, extents, visible);
+        }
+        const double vectorized = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / Iterations;
+        const std::vector<int> vectorizedVisible = visible;
+
+        start = Clock::now();
+        for (int i = 0; i < Iterations; ++i) {
+            visible.clear();
+            c_adv::cullBoundsScalar(
+                bounds.minX(), bounds.minY(), bounds.maxX(), bounds.maxY(), bounds.size(), extents, visible);
+        }
+        const double scalar = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / Iterations;
+
+        std::cout << n << ": " << vectorized << "us / " << scalar << "us";
+        if (vectorizedVisible != visible) {
+            std::cout << " MISMATCH";
+            mismatch = true;
+        }
+        std::cout << "\n";
+    }
+
+    return mismatch ? 1 : 0;
+}